@@ -0,0 +1,224 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Opening book
+//
+// The book is a file of (position, move, weight) entries sorted by position,
+// mapped read-only from the file named by the bookfile option.  A probe is a
+// binary search for the position, after which one of its moves is picked at
+// random in proportion to the weights.  Positions are keyed rather than move
+// sequences, so that a book position is found however it was reached.
+//
+// https://www.chessprogramming.org/Opening_Book
+
+#include "./book.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./search.h"
+#include "./util.h"
+
+char BOOK_FILE[MAX_CHARS_IN_PATH];
+
+static const bookEntry_t* book_entries = NULL;  // NULL when no book is loaded
+static uint64_t book_num_entries;
+static void* book_mapping = NULL;
+static size_t book_mapping_size;
+
+// The engine's Zobrist keys are drawn at random on every run, so the book
+// keys positions with numbers of its own that never change: a hash of each
+// (square, piece) pair.
+//
+// https://prng.di.unimi.it/splitmix64.c
+static uint64_t book_random(uint64_t i) {
+  uint64_t z = (i + 1) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+uint64_t book_key(position_t* p) {
+  uint64_t key = 0;
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      piece_t piece = p->board[square_of(f, r)] & ((1 << PIECE_SIZE) - 1);
+      if (ptype_of(piece) != EMPTY) {
+        key ^= book_random((f * BOARD_WIDTH + r) << PIECE_SIZE | piece);
+      }
+    }
+  }
+  if (color_to_move_of(p) == BLACK) {
+    key ^= book_random(NUM_BB_SQUARES << PIECE_SIZE);
+  }
+  return key;
+}
+
+// Maps the book in the file at path, replacing the one loaded if any.  An
+// empty path, or one naming no file, just unloads.  Returns false unless a
+// book is loaded.
+bool book_load(const char* path) {
+  if (book_mapping != NULL) {
+    munmap(book_mapping, book_mapping_size);
+    book_mapping = NULL;
+    book_entries = NULL;
+  }
+
+  int fd = path[0] == '\0' ? -1 : open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  bookHeader_t header;
+  if (fstat(fd, &st) != 0 || read(fd, &header, sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, BOOK_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != BOOK_VERSION ||
+      (uint64_t) st.st_size !=
+          sizeof(header) + header.entries * sizeof(bookEntry_t)) {
+    fprintf(stderr, "%s is not an opening book\n", path);
+    close(fd);
+    return false;
+  }
+  void* mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    fprintf(stderr, "Could not map opening book %s\n", path);
+    return false;
+  }
+
+  book_mapping = mapping;
+  book_mapping_size = st.st_size;
+  book_entries = (const bookEntry_t*) ((char*) mapping + sizeof(header));
+  book_num_entries = header.entries;
+  return true;
+}
+
+// Writes the path of the book.bin next to the executable into path, so that
+// the default book is found whatever directory the engine is started from
+// (the autotester starts it from tests/).  Falls back on "book.bin".
+void book_default_file(char* path, size_t size) {
+  char exe[MAX_CHARS_IN_PATH];
+  ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+  char* slash = NULL;
+  if (n > 0) {
+    exe[n] = '\0';
+    slash = strrchr(exe, '/');
+  }
+  if (slash == NULL ||
+      snprintf(path, size, "%.*s/book.bin", (int) (slash - exe), exe) >=
+          (int) size) {
+    snprintf(path, size, "book.bin");
+  }
+}
+
+uint64_t book_loaded_entries() {
+  return book_entries == NULL ? 0 : book_num_entries;
+}
+
+// Whether mv can be played in p: the book may have been made for another
+// version of the rules, or the position reached with a different history.
+static bool book_move_ok(position_t* p, move_t mv, sortable_move_t* moves,
+                         int num_moves) {
+  for (int i = 0; i < num_moves; i++) {
+    if (get_move(moves[i]) == mv) {
+      position_t next;
+      return !is_KO(make_move(p, &next, mv));
+    }
+  }
+  return false;
+}
+
+// Returns a book move for p, or 0 if the book has none.
+move_t book_probe(position_t* p) {
+  if (book_entries == NULL) {
+    return 0;
+  }
+  uint64_t key = book_key(p);
+
+  // first entry of p, if any
+  uint64_t lo = 0;
+  uint64_t hi = book_num_entries;
+  while (lo < hi) {
+    uint64_t mid = lo + (hi - lo) / 2;
+    if (book_entries[mid].key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == book_num_entries || book_entries[lo].key != key) {
+    return 0;
+  }
+
+  sortable_move_t moves[MAX_NUM_MOVES];
+  int num_moves = generate_all(p, moves, true);
+  uint64_t total = 0;
+  for (uint64_t i = lo; i < book_num_entries && book_entries[i].key == key; i++) {
+    if (book_move_ok(p, book_entries[i].move, moves, num_moves)) {
+      total += book_entries[i].weight;
+    }
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  uint64_t pick = myrand() % total;
+  for (uint64_t i = lo; i < book_num_entries && book_entries[i].key == key; i++) {
+    if (book_move_ok(p, book_entries[i].move, moves, num_moves)) {
+      if (pick < book_entries[i].weight) {
+        return book_entries[i].move;
+      }
+      pick -= book_entries[i].weight;
+    }
+  }
+  return 0;
+}
+
+static int compare_entries(const void* a, const void* b) {
+  const bookEntry_t* x = a;
+  const bookEntry_t* y = b;
+  if (x->key != y->key) {
+    return x->key < y->key ? -1 : 1;
+  }
+  if (x->move != y->move) {
+    return x->move < y->move ? -1 : 1;
+  }
+  return 0;
+}
+
+// Writes entries to path as a book, sorting them and adding up the weights of
+// entries with the same position and move on the way.  Returns false if the
+// file could not be written.
+bool book_write(const char* path, bookEntry_t* entries, uint64_t num_entries) {
+  qsort(entries, num_entries, sizeof(bookEntry_t), compare_entries);
+  uint64_t n = 0;
+  for (uint64_t i = 0; i < num_entries; i++) {
+    if (n > 0 && compare_entries(&entries[n - 1], &entries[i]) == 0) {
+      entries[n - 1].weight += entries[i].weight;
+    } else {
+      entries[n++] = entries[i];
+    }
+  }
+
+  // write a new file and rename it over the old one, which may be mapped
+  char tmp[MAX_CHARS_IN_PATH + 4];
+  if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) {
+    return false;
+  }
+  FILE* f = fopen(tmp, "wb");
+  if (f == NULL) {
+    return false;
+  }
+  bookHeader_t header;
+  memcpy(header.magic, BOOK_MAGIC, sizeof(header.magic));
+  header.version = BOOK_VERSION;
+  header.entries = n;
+  bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+            fwrite(entries, sizeof(bookEntry_t), n, f) == n;
+  ok = fclose(f) == 0 && ok;
+  return ok && rename(tmp, path) == 0;
+}
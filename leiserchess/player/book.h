@@ -0,0 +1,49 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Opening book
+
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "./move_gen.h"
+
+#define BOOK_MAGIC "LCBK"
+#define BOOK_VERSION 1
+
+// File layout: this header, then the entries sorted by key
+typedef struct bookHeader {
+  char     magic[4];  // BOOK_MAGIC
+  uint32_t version;   // BOOK_VERSION
+  uint64_t entries;
+} bookHeader_t;
+
+// One candidate move of a position.  A position has as many entries as it
+// has candidates, next to each other.
+typedef struct bookEntry {
+  uint64_t key;     // book_key() of the position
+  move_t   move;
+  uint32_t weight;  // how often to play move, relative to the other entries
+} bookEntry_t;
+
+// Limits of book_generate() (see bookgen.c)
+#define BOOKGEN_MAX_PLIES 32
+#define BOOKGEN_MAX_WIDTH 8
+
+// Path of the book file, set by the bookfile option ("" for none)
+extern char BOOK_FILE[MAX_CHARS_IN_PATH];
+
+uint64_t book_key(position_t* p);
+void book_default_file(char* path, size_t size);
+bool book_load(const char* path);
+uint64_t book_loaded_entries();
+move_t book_probe(position_t* p);
+bool book_write(const char* path, bookEntry_t* entries, uint64_t num_entries);
+bool book_generate(position_t* p, const char* path, int plies, int depth,
+                   int width, int margin, FILE* out);
+
+#endif  // BOOK_H
@@ -0,0 +1,446 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Opening book generator
+//
+// The book is grown breadth-first from the position it is generated for, one
+// ply at a time.  Every position of a ply is searched to a fixed depth, and
+// its best move becomes a book entry, along with up to width - 1 runners-up
+// scoring within margin of it; a runner-up is found by searching the position
+// again without the moves taken so far.  The positions the entries lead to
+// make up the next ply, with transpositions merged by book key so that each
+// position is searched once.
+//
+// The positions of a ply are shared out among smp_threads worker threads,
+// each running searches of its own in Lazy SMP fashion, so that nothing but
+// the transposition table is shared between them.  After every ply the work
+// done so far is saved to <file>.ckpt, from which a later run with the same
+// settings carries on; the book itself is written once all plies are done.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+#include "./book.h"
+#include "./search.h"
+#include "./timeman.h"
+#include "./tt.h"
+#include "./util.h"
+
+// defined in search.c
+extern int SMP_MODE;
+extern int SMP_THREADS;
+
+#define BOOKGEN_MAGIC "LCBG"
+#define BOOKGEN_VERSION 1
+// room for the book path plus ".ckpt"
+#define BOOKGEN_CHECKPOINT_SIZE (MAX_CHARS_IN_PATH + 8)
+
+// A book position, as the moves leading to it from the root
+typedef struct bookLine {
+  int    plies;
+  move_t moves[BOOKGEN_MAX_PLIES];
+} bookLine_t;
+
+// Candidate moves found for a position, best first
+typedef struct bookResult {
+  int      num_moves;
+  move_t   moves[BOOKGEN_MAX_WIDTH];
+  uint32_t weights[BOOKGEN_MAX_WIDTH];
+} bookResult_t;
+
+// Checkpoint layout: this header, then the entries, the keys of the positions
+// seen so far, and the lines of the next ply to search.
+typedef struct bookgenHeader {
+  char     magic[4];  // BOOKGEN_MAGIC
+  uint32_t version;   // BOOKGEN_VERSION
+  uint64_t root;      // book_key() of the root
+  int32_t  depth;
+  int32_t  width;
+  int32_t  margin;
+  int32_t  plies;     // plies done
+  uint64_t entries;
+  uint64_t seen;
+  uint64_t lines;
+} bookgenHeader_t;
+
+typedef struct {
+  bookgenHeader_t header;  // settings and progress
+  position_t* root;
+
+  bookEntry_t* entries;
+  uint64_t entries_size;
+
+  // Open-addressed set of the keys of the positions seen, 0 marking a free
+  // slot.  Its size is a power of 2, kept at least twice the count.
+  uint64_t* seen;
+  uint64_t seen_size;
+
+  bookLine_t* lines;  // positions of the ply being searched ...
+  bookResult_t* results;  // ... and what was found for them
+  uint64_t next_line;  // next one for a worker to take
+} bookgen_t;
+
+// Appends the item of the given size to *array, which holds *count items and
+// has room for *size, growing it as needed.
+static void push(void** array, uint64_t* count, uint64_t* size,
+                 const void* item, size_t bytes) {
+  if (*count == *size) {
+    *size = *size == 0 ? 1024 : 2 * *size;
+    *array = realloc(*array, *size * bytes);
+    if (*array == NULL) {
+      fprintf(stderr, "Out of memory generating the book\n");
+      exit(1);
+    }
+  }
+  memcpy((char*) *array + *count * bytes, item, bytes);
+  (*count)++;
+}
+
+// Adds key to the seen set.  Returns false if it was there already.
+static bool see(bookgen_t* g, uint64_t key) {
+  if (2 * (g->header.seen + 1) > g->seen_size) {
+    uint64_t old_size = g->seen_size;
+    uint64_t* old = g->seen;
+    g->seen_size = old_size == 0 ? 1024 : 2 * old_size;
+    g->seen = calloc(g->seen_size, sizeof(uint64_t));
+    if (g->seen == NULL) {
+      fprintf(stderr, "Out of memory generating the book\n");
+      exit(1);
+    }
+    g->header.seen = 0;
+    for (uint64_t i = 0; i < old_size; i++) {
+      if (old[i] != 0) {
+        see(g, old[i]);
+      }
+    }
+    free(old);
+  }
+
+  key = key == 0 ? 1 : key;  // as good as any other
+  uint64_t i = key & (g->seen_size - 1);
+  while (g->seen[i] != 0) {
+    if (g->seen[i] == key) {
+      return false;
+    }
+    i = (i + 1) & (g->seen_size - 1);
+  }
+  g->seen[i] = key;
+  g->header.seen++;
+  return true;
+}
+
+// Plays line out from the root into positions, which must have room for
+// line->plies + 1 of them, and returns the last.
+static position_t* replay(bookgen_t* g, bookLine_t* line,
+                          position_t* positions) {
+  positions[0] = *g->root;
+  for (int i = 0; i < line->plies; i++) {
+    make_move(&positions[i], &positions[i + 1], line->moves[i]);
+  }
+  return &positions[line->plies];
+}
+
+// Whether the side to move in p has lost its king, ending the game
+static bool game_over(position_t* p) {
+  return ptype_of(p->board[p->kloc[WHITE]]) != KING ||
+         ptype_of(p->board[p->kloc[BLACK]]) != KING;
+}
+
+// Finds the book moves of p.
+static void search_position(bookgen_t* g, position_t* p, bookResult_t* result,
+                            uint64_t* node_count) {
+  rootState_t root;
+  move_t pv[MAX_PLY_IN_SEARCH];
+  score_t best = 0;
+
+  root.key = 0;
+  result->num_moves = 0;
+  for (int d = 1; d <= g->header.depth; d++) {
+    pv[0] = 0;
+    best = searchRoot(&root, p, -INF, INF, d, 0, pv, node_count, NULL);
+  }
+
+  while (pv[0] != 0) {
+    score_t score = best;
+    if (result->num_moves > 0) {
+      // search again without the moves already taken, which only works
+      // from depth 2 on: searchRoot makes the move list afresh at depth 1
+      if (root.num_moves == 0 || g->header.depth < 2) {
+        break;
+      }
+      pv[0] = 0;
+      score = searchRoot(&root, p, -INF, INF, g->header.depth, 0, pv,
+                         node_count, NULL);
+      if (pv[0] == 0 || score < best - g->header.margin) {
+        break;
+      }
+    }
+    result->moves[result->num_moves] = pv[0];
+    result->weights[result->num_moves] = g->header.margin + 1 - (best - score);
+    result->num_moves++;
+    if (result->num_moves == g->header.width) {
+      break;
+    }
+
+    for (int i = 0; i < root.num_moves; i++) {
+      if (get_move(root.moves[i]) == pv[0]) {
+        root.moves[i] = root.moves[--root.num_moves];
+        break;
+      }
+    }
+  }
+}
+
+typedef struct {
+  pthread_t thread;
+  int id;  // worker slot
+  bookgen_t* g;
+  uint64_t count;  // number of lines
+  uint64_t node_count;
+} bookgenWorker;
+
+static void* worker_main(void* arg) {
+  bookgenWorker* worker = (bookgenWorker*) arg;
+  bookgen_t* g = worker->g;
+  position_t positions[BOOKGEN_MAX_PLIES + 1];
+
+  thread_worker_slot = worker->id;
+  while (true) {
+    uint64_t i = __sync_fetch_and_add(&g->next_line, 1);
+    if (i >= worker->count) {
+      break;
+    }
+    position_t* p = replay(g, &g->lines[i], positions);
+    search_position(g, p, &g->results[i], &worker->node_count);
+  }
+  return NULL;
+}
+
+// Searches the count lines of the current ply, in parallel.  Returns the
+// number of nodes searched.
+static uint64_t search_ply(bookgen_t* g, uint64_t count) {
+  bookgenWorker workers[MAX_WORKERS];
+  int num_workers = 0;
+  uint64_t node_count = 0;
+
+  g->results = realloc(g->results, (count > 0 ? count : 1) *
+                       sizeof(bookResult_t));
+  if (g->results == NULL) {
+    fprintf(stderr, "Out of memory generating the book\n");
+    exit(1);
+  }
+  g->next_line = 0;
+  for (int i = 0; i < SMP_THREADS && first_helper_slot() + i < MAX_WORKERS;
+       i++) {
+    bookgenWorker* worker = &workers[num_workers];
+    worker->id = first_helper_slot() + i;  // worker slot (see util.h)
+    worker->g = g;
+    worker->count = count;
+    worker->node_count = 0;
+    if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+      break;
+    }
+    num_workers++;
+  }
+  if (num_workers == 0) {
+    // search on this thread, in whatever slot it has
+    bookgenWorker self = { .id = -1, .g = g, .count = count, .node_count = 0 };
+    worker_main(&self);
+    node_count = self.node_count;
+  }
+  for (int i = 0; i < num_workers; i++) {
+    pthread_join(workers[i].thread, NULL);
+    node_count += workers[i].node_count;
+  }
+  return node_count;
+}
+
+// Turns the results of the count lines just searched into entries, and the
+// positions they lead to into the lines of the next ply.  Returns the number
+// of the new lines.
+static uint64_t expand_ply(bookgen_t* g, uint64_t count) {
+  position_t positions[BOOKGEN_MAX_PLIES + 2];
+  bookLine_t* next = NULL;
+  uint64_t next_count = 0;
+  uint64_t next_size = 0;
+
+  for (uint64_t i = 0; i < count; i++) {
+    bookLine_t* line = &g->lines[i];
+    bookResult_t* result = &g->results[i];
+    position_t* p = replay(g, line, positions);
+    uint64_t key = book_key(p);
+    for (int j = 0; j < result->num_moves; j++) {
+      bookEntry_t entry = { key, result->moves[j], result->weights[j] };
+      push((void**) &g->entries, &g->header.entries, &g->entries_size, &entry,
+           sizeof(entry));
+
+      position_t* child = p + 1;
+      make_move(p, child, result->moves[j]);
+      if (line->plies < BOOKGEN_MAX_PLIES && !game_over(child) &&
+          see(g, book_key(child))) {
+        bookLine_t next_line = *line;
+        next_line.moves[next_line.plies++] = result->moves[j];
+        push((void**) &next, &next_count, &next_size, &next_line,
+             sizeof(next_line));
+      }
+    }
+  }
+
+  free(g->lines);
+  g->lines = next;
+  g->header.lines = next_count;
+  return next_count;
+}
+
+static bool write_checkpoint(bookgen_t* g, const char* path) {
+  char tmp[BOOKGEN_CHECKPOINT_SIZE + 4];
+  if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) {
+    return false;
+  }
+  FILE* f = fopen(tmp, "wb");
+  if (f == NULL) {
+    return false;
+  }
+  bool ok = fwrite(&g->header, sizeof(g->header), 1, f) == 1 &&
+            fwrite(g->entries, sizeof(bookEntry_t), g->header.entries, f) ==
+                g->header.entries;
+  for (uint64_t i = 0; ok && i < g->seen_size; i++) {
+    if (g->seen[i] != 0) {
+      ok = fwrite(&g->seen[i], sizeof(uint64_t), 1, f) == 1;
+    }
+  }
+  ok = ok && fwrite(g->lines, sizeof(bookLine_t), g->header.lines, f) ==
+                 g->header.lines;
+  ok = fclose(f) == 0 && ok;
+  // replace the old checkpoint only once the new one is complete
+  return ok && rename(tmp, path) == 0;
+}
+
+// Picks up from the checkpoint at path, if there is one for the same root
+// and settings.
+static bool read_checkpoint(bookgen_t* g, const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (f == NULL) {
+    return false;
+  }
+  bookgenHeader_t header;
+  bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+            memcmp(header.magic, BOOKGEN_MAGIC, sizeof(header.magic)) == 0 &&
+            header.version == BOOKGEN_VERSION &&
+            header.root == g->header.root && header.depth == g->header.depth &&
+            header.width == g->header.width &&
+            header.margin == g->header.margin;
+  if (ok) {
+    g->entries_size = header.entries > 0 ? header.entries : 1;
+    g->entries = malloc(g->entries_size * sizeof(bookEntry_t));
+    g->lines = malloc((header.lines > 0 ? header.lines : 1) *
+                      sizeof(bookLine_t));
+    ok = g->entries != NULL && g->lines != NULL &&
+         fread(g->entries, sizeof(bookEntry_t), header.entries, f) ==
+             header.entries;
+    for (uint64_t i = 0; ok && i < header.seen; i++) {
+      uint64_t key;
+      ok = fread(&key, sizeof(key), 1, f) == 1;
+      see(g, key);
+    }
+    ok = ok && fread(g->lines, sizeof(bookLine_t), header.lines, f) ==
+                   header.lines;
+  }
+  fclose(f);
+  if (!ok) {
+    fprintf(stderr, "Ignoring checkpoint %s: not for this book\n", path);
+    free(g->entries);
+    free(g->seen);
+    free(g->lines);
+    g->entries = NULL;
+    g->entries_size = 0;
+    g->seen = NULL;
+    g->seen_size = 0;
+    g->header.seen = 0;
+    g->lines = NULL;
+    return false;
+  }
+  g->header.plies = header.plies;
+  g->header.entries = header.entries;
+  g->header.lines = header.lines;
+  return true;
+}
+
+bool book_generate(position_t* p, const char* path, int plies, int depth,
+                   int width, int margin, FILE* out) {
+  char checkpoint[BOOKGEN_CHECKPOINT_SIZE];
+  if (snprintf(checkpoint, sizeof(checkpoint), "%s.ckpt", path) >=
+      (int) sizeof(checkpoint)) {
+    fprintf(stderr, "Book path too long: %s\n", path);
+    return false;
+  }
+
+  bookgen_t g;
+  memset(&g, 0, sizeof(g));
+  memcpy(g.header.magic, BOOKGEN_MAGIC, sizeof(g.header.magic));
+  g.header.version = BOOKGEN_VERSION;
+  g.header.root = book_key(p);
+  g.header.depth = depth;
+  g.header.width = width;
+  g.header.margin = margin;
+  g.root = p;
+
+  if (read_checkpoint(&g, checkpoint)) {
+    fprintf(out, "info string bookgen resuming after ply %d\n",
+            g.header.plies);
+  } else {
+    bookLine_t root_line = { .plies = 0 };
+    g.lines = malloc(sizeof(bookLine_t));
+    g.lines[0] = root_line;
+    g.header.lines = 1;
+    see(&g, g.header.root);
+  }
+
+  // Each worker searches serially, as a Lazy SMP helper would
+  int smp_mode = SMP_MODE;
+  SMP_MODE = SMP_LAZY;
+  tm_start_unlimited();
+  init_abort_timer(tm_maximum());
+  reset_abort();
+  init_best_move_history();
+  tt_age_hashtable();
+
+  double start = milliseconds();
+  uint64_t node_count = 0;
+  bool ok = true;
+  while (g.header.plies < plies && g.header.lines > 0) {
+    uint64_t count = g.header.lines;
+    node_count += search_ply(&g, count);
+    expand_ply(&g, count);
+    g.header.plies++;
+    fprintf(out, "info string bookgen ply %d positions %" PRIu64 " entries %"
+            PRIu64 " nodes %" PRIu64 " time %.0f\n", g.header.plies, count,
+            g.header.entries, node_count, milliseconds() - start);
+    if (!write_checkpoint(&g, checkpoint)) {
+      fprintf(stderr, "Could not write %s\n", checkpoint);
+      ok = false;
+      break;
+    }
+  }
+  SMP_MODE = smp_mode;
+
+  if (ok) {
+    ok = book_write(path, g.entries, g.header.entries);
+    if (ok) {
+      unlink(checkpoint);
+      fprintf(out, "info string bookgen wrote %s\n", path);
+    } else {
+      fprintf(stderr, "Could not write %s\n", path);
+    }
+  }
+  free(g.entries);
+  free(g.seen);
+  free(g.lines);
+  free(g.results);
+  return ok;
+}
@@ -2,6 +2,13 @@
 
 #include "./end_game.h"
 
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // check the victim pieces returned by the move to determine if it's a
 // game-over situation.  If so, also calculate the score depending on
 // the pov (which player's point of view)
@@ -29,13 +36,125 @@ static score_t get_game_over_score(victims_t victims, int pov, int ply) {
 }
 
 
-// Here's a great spot to add in a closing book/end game table if you choose to implement one.
+// -----------------------------------------------------------------------------
+// Endgame tablebase
+//
+// The table is mapped read-only from the file named by the tbpath option, so
+// that it is shared with the page cache rather than read in, and a probe is an
+// index computation and a single byte load.
+//
+// https://www.chessprogramming.org/Endgame_Tablebases
+// -----------------------------------------------------------------------------
+
+char TB_PATH[MAX_CHARS_IN_PATH];
+
+static const int8_t* tb_table = NULL;  // NULL when no table is loaded
+static int tb_pawns;
+static void* tb_mapping = NULL;
+static size_t tb_mapping_size;
+
+uint64_t tb_num_entries(int pawns) {
+  uint64_t pawn_slots = pawns > 0 ? TB_PAWN_SLOTS : 1;
+  return 2 * TB_KING_SLOTS * TB_KING_SLOTS * pawn_slots;
+}
+
+static int tb_slot_of(piece_t x, square_t sq) {
+  return bb_index_of_square[sq] * NUM_ORI + ori_of(x);
+}
+
+// Index of p in a table going up to pawns pawns, or -1 if p is not in it.
+int64_t tb_index(position_t* p, int pawns) {
+  bitboard_t pawn_bb = p->bb_ptype[0];  // indexed by ptype - PAWN
+  int num_pawns = __builtin_popcountll(pawn_bb);
+  if (num_pawns > pawns) {
+    return -1;
+  }
+  square_t wk = p->kloc[WHITE];
+  square_t bk = p->kloc[BLACK];
+  if (ptype_of(p->board[wk]) != KING || ptype_of(p->board[bk]) != KING) {
+    return -1;  // a king was zapped
+  }
+
+  int64_t index = color_to_move_of(p);
+  index = index * TB_KING_SLOTS + tb_slot_of(p->board[wk], wk);
+  index = index * TB_KING_SLOTS + tb_slot_of(p->board[bk], bk);
+  if (pawns > 0) {
+    int pawn_slot = 0;
+    if (pawn_bb != 0) {
+      square_t sq = square_of_bb_index[__builtin_ctzll(pawn_bb)];
+      piece_t x = p->board[sq];
+      pawn_slot = 1 + color_of(x) * TB_KING_SLOTS + tb_slot_of(x, sq);
+    }
+    index = index * TB_PAWN_SLOTS + pawn_slot;
+  }
+  return index;
+}
+
+// Maps the table in the file at path, replacing the one loaded if any.  An
+// empty path just unloads.  Returns false if path does not hold a table.
+bool tb_load(const char* path) {
+  if (tb_mapping != NULL) {
+    munmap(tb_mapping, tb_mapping_size);
+    tb_mapping = NULL;
+    tb_table = NULL;
+  }
+  if (path[0] == '\0') {
+    return true;
+  }
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Could not open tablebase %s\n", path);
+    return false;
+  }
+  struct stat st;
+  tbHeader_t header;
+  if (fstat(fd, &st) != 0 || read(fd, &header, sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, TB_MAGIC, sizeof(header.magic)) != 0 ||
+      header.pawns > TB_MAX_PAWNS ||
+      header.entries != tb_num_entries(header.pawns) ||
+      (uint64_t) st.st_size != sizeof(header) + header.entries) {
+    fprintf(stderr, "%s is not a tablebase\n", path);
+    close(fd);
+    return false;
+  }
+  void* mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    fprintf(stderr, "Could not map tablebase %s\n", path);
+    return false;
+  }
+
+  tb_mapping = mapping;
+  tb_mapping_size = st.st_size;
+  tb_table = (const int8_t*) ((char*) mapping + sizeof(header));
+  tb_pawns = header.pawns;
+  return true;
+}
+
+uint64_t tb_loaded_entries() {
+  return tb_table == NULL ? 0 : tb_num_entries(tb_pawns);
+}
+
+// Value of p in the tablebase (see end_game.h), 0 if it has none or it is a
+// draw.  Draws are left to the search, which scores repetitions itself.
+static int tb_value(position_t* p) {
+  if (tb_table == NULL) {
+    return 0;
+  }
+  int64_t index = tb_index(p, tb_pawns);
+  if (index < 0) {
+    return 0;
+  }
+  int8_t value = tb_table[index];
+  return value == TB_UNKNOWN ? 0 : value;
+}
 
 // In this function, determine if the position is in the end game table or not.
 bool is_end_game_position(position_t* p, int pov, int ply) {
   // Note: pov and ply are for the move that *generated* this position, not the position itself.
   //       This means you might have an off-by-one error when reading from your closing book.
-  return is_game_over(p->victims, pov, ply);
+  return is_game_over(p->victims, pov, ply) || tb_value(p) != 0;
 }
 
 // In this function, read the end game table and return the score of this position,
@@ -48,5 +167,15 @@ bool is_end_game_position(position_t* p, int pov, int ply) {
 score_t get_end_game_score(position_t* p, int pov, int ply) {
   // Note: pov and ply are for the move that *generated* this position, not the position itself.
   //       This means you might have an off-by-one error when reading from your closing book.
+  if (is_game_over(p->victims, pov, ply)) {
     return get_game_over_score(p->victims, pov, ply);
+  }
+  // p is one ply below the mover, and its side to move is the mover's
+  // opponent: the game ends on ply + distance.
+  int value = tb_value(p);
+  int distance = value > 0 ? value : -value;
+  if (value > 0) {
+    return -WIN + ply + distance;
+  }
+  return WIN - ply - distance;
 }
@@ -12,4 +12,39 @@ bool is_end_game_position(position_t* p, int pov, int ply);
 
 score_t get_end_game_score(position_t* p, int pov, int ply);
 
+// -----------------------------------------------------------------------------
+// Endgame tablebase
+// -----------------------------------------------------------------------------
+
+// The tablebase holds one int8_t per position with both kings and at most
+// TB_MAX_PAWNS pawns: the number of plies until the game ends with best play,
+// the last one being the move that zaps a king, positive if the side to move
+// wins, negative if it loses.  0 is a draw, TB_UNKNOWN a position that is not
+// a position (pieces on top of each other) or was not resolved.  The table is
+// generated by tbgen (see tbgen.c).
+#define TB_MAX_PAWNS 1
+#define TB_UNKNOWN INT8_MIN
+
+// Each king takes one of these slots (square and orientation) ...
+#define TB_KING_SLOTS (NUM_BB_SQUARES * NUM_ORI)
+// ... and the pawn one of these: none, or its color, square and orientation
+#define TB_PAWN_SLOTS (1 + 2 * NUM_BB_SQUARES * NUM_ORI)
+
+#define TB_MAGIC "LCTB"
+
+// File layout: this header, then the entries
+typedef struct tbHeader {
+  char     magic[4];  // TB_MAGIC
+  uint32_t pawns;     // pawns the table goes up to
+  uint64_t entries;   // tb_num_entries(pawns)
+} tbHeader_t;
+
+// Path of the tablebase file, set by the tbpath option ("" for none)
+extern char TB_PATH[MAX_CHARS_IN_PATH];
+
+uint64_t tb_num_entries(int pawns);
+int64_t tb_index(position_t* p, int pawns);
+bool tb_load(const char* path);
+uint64_t tb_loaded_entries();
+
 #endif  // END_GAME_H
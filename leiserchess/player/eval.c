@@ -10,6 +10,10 @@
 #include <string.h>
 #include "./move_gen.h"
 #include "./tbassert.h"
+#include "./util.h"
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
 
 // -----------------------------------------------------------------------------
 // Evaluation
@@ -26,6 +30,8 @@ int KFACE;
 int KAGGRESSIVE;
 int MOBILITY;
 int LCOVERAGE;
+int COVERAGE_CACHE;
+int EVAL_HASH;
 
 char blank_laser_map[ARR_SIZE] = {
   4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
@@ -158,7 +164,7 @@ ev_score_t kaggressive(position_t* p, fil_t f, rnk_t r) {
 }
 
 // Marks the path/line-of-sight of the laser until it hits a piece or goes off
-// the board.
+// the board.  Only on-board squares are marked.
 //
 // p : Current board state.
 // c : Color of king shooting laser.
@@ -167,95 +173,99 @@ ev_score_t kaggressive(position_t* p, fil_t f, rnk_t r) {
 // mark_mask : What each square is marked with.
 void mark_laser_path(position_t* p, color_t c, char* laser_map,
                      char mark_mask) {
-  square_t sq = p->kloc[c];
-  int bdir = ori_of(p->board[sq]);
+  bitboard_t path = laser_path_bb(p, c);
+  while (path) {
+    laser_map[bb_pop_square(&path)] |= mark_mask;
+  }
+}
 
-  tbassert(ptype_of(p->board[sq]) == KING,
-           "ptype: %d\n", ptype_of(p->board[sq]));
-  laser_map[sq] |= mark_mask;
+// One straight piece of a laser beam, as recorded by trace_laser().
+typedef struct {
+  square_t     sq;        // king or pawn the segment leaves from
+  int          bdir;      // direction it leaves in
+  int          length;    // path length counted on leaving sq
+  bitboard_t   squares;   // squares crossed, including the piece stopping it
+} laser_segment_t;
+
+// A beam bounces off each pawn at most once per mirror face.
+#define MAX_LASER_SEGMENTS (2 * NUM_PIECES + 2)
+
+// Traces the laser of color c on p (whose occupied squares are occupied),
+// starting as if the beam had just left sq
+// in direction bdir with path length length, and lowers each on-board square
+// of the remaining path to its path length in laser_map.  Bouncing off an
+// opposing pawn counts two extra steps.  The squares marked are added to
+// *covered.  If segs is not NULL the segments are recorded there.  Returns the
+// number of segments.
+//
+// Each straight segment comes from the ray tables in one lookup; the length
+// of a square within a segment is its bit distance from the segment's start
+// (bits are 8 apart along a rank and 1 apart along a file).
+static int trace_laser(position_t* p, bitboard_t occupied, color_t c,
+                       square_t sq, int bdir, int length, float* laser_map,
+                       bitboard_t* covered, laser_segment_t* segs) {
+  int num_segs = 0;
 
   while (true) {
-    sq += beam_of(bdir);
-    laser_map[sq] |= mark_mask;
-    tbassert(sq < ARR_SIZE && sq >= 0, "sq: %d\n", sq);
-
-    switch (ptype_of(p->board[sq])) {
-    case EMPTY:  // empty square
-      break;
-    case PAWN:  // Pawn
-      bdir = reflect_of(bdir, ori_of(p->board[sq]));
-      if (bdir < 0) {  // Hit back of Pawn
-        return;
+    square_t blocker = laser_first_blocker(occupied, sq, bdir);
+    bitboard_t segment = laser_segment_bb(sq, bdir, blocker);
+    int start = bb_index_of_square[sq];
+    int shift = (bdir == EE || bdir == WW) ? 3 : 0;
+
+    if (segs != NULL) {
+      tbassert(num_segs < MAX_LASER_SEGMENTS, "num_segs: %d\n", num_segs);
+      segs[num_segs] = (laser_segment_t) {sq, bdir, length, segment};
+    }
+    num_segs++;
+    *covered |= segment;
+
+    while (segment) {
+      int i = __builtin_ctzll(segment);
+      segment &= segment - 1;
+      int dist = length + (abs(i - start) >> shift) - 1;
+      // set laser map to min
+      if (laser_map[square_of_bb_index[i]] > dist) {
+        laser_map[square_of_bb_index[i]] = dist;
       }
-      break;
-    case KING:  // King
-      return;  // sorry, game over my friend!
-      break;
-    case INVALID:  // Ran off edge of board
-      return;
-      break;
-    default:  // Shouldna happen, man!
-      tbassert(false, "Not cool, man.  Not cool.\n");
-      break;
+    }
+
+    if (blocker == 0) {  // Ran off edge of board
+      return num_segs;
+    }
+    length += abs(bb_index_of_square[blocker] - start) >> shift;
+    sq = blocker;
+
+    piece_t x = p->board[sq];
+    if (ptype_of(x) == KING) {
+      return num_segs;  // sorry, game over my friend!
+    }
+    bdir = reflect_of(bdir, ori_of(x));
+    if (bdir < 0) {  // Hit back of Pawn
+      return num_segs;
+    }
+
+    // if bouncing off an opposing pawn, add extra to the length of path
+    // because the opponent can affect it
+    if (color_of(x) != c) {
+      length += 2;
     }
   }
 }
 
 // Marks the path/line-of-sight of the laser until it hits a piece or goes off
-// the board.
-// Increment for each time you touch a square with the laser
+// the board.  Each on-board square on the path is lowered to its distance
+// along the beam from the king.
 //
 // p : Current board state.
 // c : Color of king shooting laser.
-// laser_map : End result will be stored here. Every square on the
-//             path of the laser is marked with mark_mask.
-// mark_mask : What each square is marked with.
+// laser_map : End result will be stored here.
 void add_laser_path(position_t* p, color_t c, float* laser_map) {
   square_t sq = p->kloc[c];
-  int bdir = ori_of(p->board[sq]);
-  int length = 1;
-
   tbassert(ptype_of(p->board[sq]) == KING,
            "ptype: %d square: %i\n", ptype_of(p->board[sq]), sq);
-  // laser_map[sq] += touch_weight;
-
-  while (true) {
-    sq += beam_of(bdir);
-
-    // set laser map to min
-    if(laser_map[sq] > length) {
-      laser_map[sq] = length;
-    }
-    length++;
-    
-    tbassert(sq < ARR_SIZE && sq >= 0, "sq: %d\n", sq);
-
-    switch (ptype_of(p->board[sq])) {
-    case EMPTY:  // empty square
-      break;
-    case PAWN:  // Pawn
-      bdir = reflect_of(bdir, ori_of(p->board[sq]));
-      if (bdir < 0) {  // Hit back of Pawn
-        return;
-      }
-
-      // if bouncing off an opposing pawn, add extra to the length of path
-      // because the opponent can affect it 
-      if (color_of(p->board[sq]) != c) {
-        length += 2;
-      }
-      break;
-    case KING:  // King
-      return;  // sorry, game over my friend!
-      break;
-    case INVALID:  // Ran off edge of board
-      return;
-      break;
-    default:  // Shouldna happen, man!
-      tbassert(false, "Not cool, man.  Not cool.\n");
-      break;
-    }
-  }
+  bitboard_t covered = 0;
+  trace_laser(p, p->bb_color[WHITE] | p->bb_color[BLACK], c, sq,
+              ori_of(p->board[sq]), 1, laser_map, &covered, NULL);
 }
 
 float mult_dist_lookup_table[10][10] = {
@@ -271,6 +281,14 @@ float mult_dist_lookup_table[10][10] = {
   {0.1, 0.05, 0.033333, 0.025, 0.02, 0.016667, 0.014286, 0.0125, 0.011111, 0.01}
 };
 
+// mult_dist() for squares delta_fil files and delta_rnk ranks apart
+static inline float mult_dist_of(int delta_fil, int delta_rnk) {
+  if (delta_fil == 0 && delta_rnk == 0) {
+    return 2;
+  }
+  return mult_dist_lookup_table[delta_rnk][delta_fil];
+}
+
 float mult_dist(square_t a, square_t b) {
   int8_t delta_fil = abs(fil_of(a) - fil_of(b));
   int8_t delta_rnk = abs(rnk_of(a) - rnk_of(b));
@@ -365,8 +383,62 @@ float laser_coverage_ref(position_t* p, color_t color) {
   return result;
 }
 
-float laser_coverage(position_t* p, color_t color) {
-  position_t np;
+// Moves the pieces of mv on p->board, and nothing else: the key, piece lists
+// and bitboards of p are left alone.  The old contents of the from,
+// intermediate and to squares are saved in saved[].  Returns the occupied
+// squares after the move.
+static bitboard_t shift_pieces(position_t* p, move_t mv, bitboard_t occupied,
+                               piece_t saved[3]) {
+  square_t from_sq = from_square(mv);
+  square_t int_sq = intermediate_square(mv);
+  square_t to_sq = to_square(mv);
+  piece_t from_piece = saved[0] = p->board[from_sq];
+  piece_t int_piece = saved[1] = p->board[int_sq];
+  piece_t to_piece = saved[2] = p->board[to_sq];
+
+  if (to_sq == from_sq) {  // rotation
+    set_ori(&from_piece, rot_of(mv) + ori_of(from_piece));
+    p->board[from_sq] = from_piece;
+    return occupied;
+  }
+
+  if (int_sq == from_sq) {  // move or swap
+    p->board[to_sq] = from_piece;
+    p->board[from_sq] = to_piece;
+  } else if (int_sq != to_sq) {  // swap, then move
+    p->board[from_sq] = int_piece;
+    p->board[int_sq] = to_piece;
+    p->board[to_sq] = from_piece;
+  } else {  // swap, then rotate
+    set_ori(&from_piece, rot_of(mv) + ori_of(from_piece));
+    p->board[from_sq] = int_piece;
+    p->board[int_sq] = from_piece;
+  }
+
+  // Only an empty to square changes hands: from_piece lands there and the
+  // square it came from ends up empty.
+  if (ptype_of(to_piece) == EMPTY) {
+    occupied ^= bb_of_square(to_sq) | bb_of_square(int_sq == from_sq ? from_sq : int_sq);
+  }
+  return occupied;
+}
+
+// Puts back the squares of mv saved by shift_pieces().
+static void unshift_pieces(position_t* p, move_t mv, piece_t saved[3]) {
+  p->board[to_square(mv)] = saved[2];
+  p->board[intermediate_square(mv)] = saved[1];
+  p->board[from_square(mv)] = saved[0];
+}
+
+// Laser coverage of color, computed incrementally.
+//
+// A move can only change the beam if it touches a square on it, and then the
+// beam is unchanged up to the first touched square.  Squares before it keep
+// the lengths already recorded for the current beam, so only the rest of the
+// beam is traced again, starting from the segment that holds that square.
+// Moves of the king itself change where the beam starts and are traced in
+// full.
+static float compute_laser_coverage(position_t* p, color_t color) {
   sortable_move_t moves[MAX_NUM_MOVES];
   int num_moves = generate_all_with_color(p, moves, color);
 
@@ -376,76 +448,90 @@ float laser_coverage(position_t* p, color_t color) {
   square_t opp_king_sq = p->kloc[opp_color(color)];
 
   float coverage_map[ARR_SIZE];
-  char laser_path[ARR_SIZE];
 
   // initialization
   for (int i = 0; i < ARR_SIZE; ++i) {
     coverage_map[i] = FLT_MAX;
-    laser_path[i] = 0;
   }
 
-  mark_laser_path(p, color, laser_path, 1);
-  add_laser_path(p, color, coverage_map);
+  bitboard_t occupied = p->bb_color[WHITE] | p->bb_color[BLACK];
+  laser_segment_t segs[MAX_LASER_SEGMENTS];
+  bitboard_t covered = 0;
+  int num_segs = trace_laser(p, occupied, color, king_sq,
+                             ori_of(p->board[king_sq]), 1, coverage_map,
+                             &covered, segs);
+  bitboard_t king_bb = bb_of_square(king_sq);
+  bitboard_t laser_path = king_bb;
+  for (int k = 0; k < num_segs; k++) {
+    laser_path |= segs[k].squares;
+  }
 
-  square_t f_square;
-  square_t t_square;
-  square_t i_square;
   // increment laser path for each possible move
   for (int i = 0; i < num_moves; i++) {
     move_t mv = get_move(moves[i]);
+    bitboard_t touched = bb_of_square(from_square(mv)) |
+                         bb_of_square(intermediate_square(mv)) |
+                         bb_of_square(to_square(mv));
 
-    f_square = from_square(mv);
-    t_square = to_square(mv);
-    i_square = intermediate_square(mv);
+    if (!(laser_path & touched)) {
+      continue;
+    }
 
-    if (laser_path[f_square] || laser_path[t_square] || laser_path[i_square]) {
-      low_level_make_move(p, &np, mv); // make the move
-      add_laser_path(&np, color, coverage_map);  // increment laser path
+    // Only the pieces matter to the beam, so the move is played on the
+    // board alone.  The king can only be the moving piece, and always ends
+    // up on the to square.
+    piece_t saved[3];
+    bitboard_t moved_occupied = shift_pieces(p, mv, occupied, saved);
+    if (touched & king_bb) {
+      square_t sq = to_square(mv);
+      trace_laser(p, moved_occupied, color, sq, ori_of(p->board[sq]), 1,
+                  coverage_map, &covered, NULL);
+    } else {
+      int k = 0;
+      while (!(segs[k].squares & touched)) {
+        k++;
+      }
+      trace_laser(p, moved_occupied, color, segs[k].sq, segs[k].bdir,
+                  segs[k].length, coverage_map, &covered, NULL);
     }
+    unshift_pieces(p, mv, saved);
   }
 
-  //memcpy(in_coverage_map, coverage_map, sizeof coverage_map);
-
-  // name it something besides laser_map
-  // initialize laser map
+  // Same sum as laser_coverage_ref(), term for term and in the same order
+  // (ascending bits run file by file, rank by rank), but with distances
+  // taken from bit coordinates.
+  int king_f = bb_index_of_square[king_sq] / BOARD_WIDTH;
+  int king_r = bb_index_of_square[king_sq] % BOARD_WIDTH;
+  int opp_f = bb_index_of_square[opp_king_sq] / BOARD_WIDTH;
+  int opp_r = bb_index_of_square[opp_king_sq] % BOARD_WIDTH;
   float result = 0;
-  square_t square;
-  float coverage_map_val;
-  // add in everything on board
-  for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
-    for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
-      square = square_of(f,r);
-      coverage_map_val = coverage_map[square];
-      if (coverage_map_val < FLT_MAX) {
-        // length of path divided by length of shortest possible path
-        // tbassert(manhattan_dist(king_sq, square_of(f, r)) <= coverage_map[square_of(f, r)], "f: %d, r: %d, dist = %d, map: %f\n", f, r, manhattan_dist(king_sq, square_of(f, r)), coverage_map[square_of(f, r)]);
-
-        // printf("before: %f, dist: %d\n", coverage_map[square_of(f, r)], manhattan_dist(king_sq, square_of(f, r)));
-        coverage_map_val = ((manhattan_dist(king_sq, square)) / coverage_map_val);
 
-        tbassert(mult_dist(square, opp_king_sq) > 0, "mult_distance must be positive");
-        coverage_map_val *= mult_dist(square, opp_king_sq);
-        result += coverage_map_val;
-        coverage_map[square] = coverage_map_val;
-      }
-    }
+  // add in everything on board
+  while (covered) {
+    int i = __builtin_ctzll(covered);
+    covered &= covered - 1;
+    int f = i / BOARD_WIDTH;
+    int r = i % BOARD_WIDTH;
+    // length of path divided by length of shortest possible path
+    float coverage_map_val =
+        (abs(f - king_f) + abs(r - king_r)) / coverage_map[square_of_bb_index[i]];
+    coverage_map_val *= mult_dist_of(abs(f - opp_f), abs(r - opp_r));
+    result += coverage_map_val;
   }
 
   // add in off-board weights
-  rnk_t r;
-  fil_t f;
-  for (f = -1; f < BOARD_WIDTH + 1; f++) {
+  for (int f = -1; f < BOARD_WIDTH + 1; f++) {
     // add in top row
-    result += mult_dist(square_of(f, -1), opp_king_sq);
+    result += mult_dist_of(abs(f - opp_f), abs(-1 - opp_r));
     // add in bottom row
-    result += mult_dist(square_of(f, BOARD_WIDTH), opp_king_sq);
+    result += mult_dist_of(abs(f - opp_f), abs(BOARD_WIDTH - opp_r));
   }
 
-  for (r = 0; r < BOARD_WIDTH; r++) {
+  for (int r = 0; r < BOARD_WIDTH; r++) {
     // add in lef col
-    result += mult_dist(square_of(-1, r), opp_king_sq);
+    result += mult_dist_of(abs(-1 - opp_f), abs(r - opp_r));
     // add in right col
-    result += mult_dist(square_of(BOARD_WIDTH, r), opp_king_sq);
+    result += mult_dist_of(abs(BOARD_WIDTH - opp_f), abs(r - opp_r));
   }
 
   tbassert(fabsf(result - laser_coverage_ref(p, color)) < .01, "YIANNI IS WRONG. his version: %f ref version: %f\n", result, laser_coverage_ref(p, color));
@@ -453,6 +539,37 @@ float laser_coverage(position_t* p, color_t color) {
   return result;
 }
 
+// Coverage depends on the board alone, so results are cached per worker thread
+// by Zobrist key.  The side to move is part of the key, and the color asked
+// for is mixed in so that both colors of a position get separate entries.
+#define COVERAGE_CACHE_SIZE 4096  // entries, a power of two
+
+typedef struct {
+  uint64_t key;
+  float    coverage;
+} coverage_entry_t;
+
+static __thread coverage_entry_t coverage_cache[COVERAGE_CACHE_SIZE];
+
+float laser_coverage(position_t* p, color_t color) {
+  if (!COVERAGE_CACHE) {
+    return compute_laser_coverage(p, color);
+  }
+
+  uint64_t key = p->key ^ (color == BLACK ? 0x9e3779b97f4a7c15ULL : 0);
+  coverage_entry_t* entry = &coverage_cache[key & (COVERAGE_CACHE_SIZE - 1)];
+  if (entry->key == key && key != 0) {
+    tbassert(entry->coverage == compute_laser_coverage(p, color),
+             "cached coverage does not match\n");
+    return entry->coverage;
+  }
+
+  float coverage = compute_laser_coverage(p, color);
+  entry->key = key;
+  entry->coverage = coverage;
+  return coverage;
+}
+
 // MOBILITY heuristic: safe squares around king of given color.
 int mobility(position_t* p, color_t color) {
   color_t c = opp_color(color);
@@ -480,8 +597,104 @@ int mobility(position_t* p, color_t color) {
   return mobility;
 }
 
+// -----------------------------------------------------------------------------
+// Evaluation cache
+// -----------------------------------------------------------------------------
+
+// Scores of evaluated positions, shared by all workers.  Each entry is one
+// word holding the high 48 bits of the key and the 16-bit score, so it is
+// written and read in one piece and needs no lock: a torn or overwritten
+// entry just fails the key check.
+//
+// https://www.chessprogramming.org/Evaluation_Hash_Table
+#define EVAL_KEY_MASK (~(uint64_t) 0xffff)
+
+static uint64_t* eval_table = NULL;
+static uint64_t  eval_table_mask;  // number of entries - 1
+
+// Probe and hit counts, one cache line per worker
+typedef struct {
+  uint64_t probes;
+  uint64_t hits;
+} __attribute__((aligned(64))) eval_hash_stats_t;
+
+static eval_hash_stats_t eval_hash_stats[MAX_WORKERS];
+
+// (Re)allocates the cache with sizeMeg megabytes, rounded down to a power of
+// two number of entries.  A size of 0 turns the cache off.
+void eval_hash_resize(int sizeMeg) {
+  free(eval_table);
+  eval_table = NULL;
+  if (sizeMeg <= 0) {
+    return;
+  }
+  uint64_t entries = 1;
+  while (entries * 2 * sizeof(uint64_t) <= ((uint64_t) sizeMeg << 20)) {
+    entries *= 2;
+  }
+  eval_table = calloc(entries, sizeof(uint64_t));
+  if (eval_table == NULL) {
+    fprintf(stderr, "Could not allocate %d MB of eval hash\n", sizeMeg);
+    return;
+  }
+  eval_table_mask = entries - 1;
+}
+
+// Forgets all cached scores.  Needed whenever the evaluation weights change.
+void eval_hash_clear() {
+  if (eval_table != NULL) {
+    memset(eval_table, 0, (eval_table_mask + 1) * sizeof(uint64_t));
+  }
+}
+
+void eval_hash_reset_stats() {
+  memset(eval_hash_stats, 0, sizeof(eval_hash_stats));
+}
+
+void eval_hash_print_stats(FILE* out) {
+  uint64_t probes = 0;
+  uint64_t hits = 0;
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    probes += eval_hash_stats[i].probes;
+    hits += eval_hash_stats[i].hits;
+  }
+  if (probes > 0) {
+    fprintf(out, "info string eval hash probes %"PRIu64" hits %"PRIu64
+            " (%.1f%%)\n", probes, hits, 100.0 * hits / probes);
+  }
+}
+
+static score_t compute_eval(position_t* p, bool verbose);
+
 // Static evaluation.  Returns score
+//
+// The cache is bypassed when printing the score components, and when the
+// score is randomized, since a cached score would repeat the same noise.
 score_t eval(position_t* p, bool verbose) {
+  if (eval_table == NULL || verbose || RANDOMIZE) {
+    return compute_eval(p, verbose);
+  }
+
+  eval_hash_stats_t* stats = &eval_hash_stats[worker_id()];
+  uint64_t* entry = &eval_table[p->key & eval_table_mask];
+  uint64_t data = *entry;
+  stats->probes++;
+  // An all-zero entry is empty; a position whose key and score match it
+  // exactly is merely never cached.
+  if (data != 0 && ((data ^ p->key) & EVAL_KEY_MASK) == 0) {
+    stats->hits++;
+    score_t score = (score_t) (uint16_t) data;
+    tbassert(score == compute_eval(p, false),
+             "cached score %d does not match\n", score);
+    return score;
+  }
+
+  score_t score = compute_eval(p, false);
+  *entry = (p->key & EVAL_KEY_MASK) | (uint16_t) score;
+  return score;
+}
+
+static score_t compute_eval(position_t* p, bool verbose) {
   // seed rand_r with a value of 1, as per
   // http://linux.die.net/man/3/rand_r
   static __thread unsigned int seed = 1;
@@ -603,3 +816,84 @@ score_t eval(position_t* p, bool verbose) {
 
  return tot / EV_SCORE_RATIO;
 }
+
+// -----------------------------------------------------------------------------
+// Evaluation benchmark
+// -----------------------------------------------------------------------------
+
+#define EVAL_BENCH_PLIES 64
+
+// Times eval() and the laser coverage term on the positions of a fixed
+// pseudo-random playout from p, reps times over.  The eval and coverage caches
+// are off while timing, and the reference coverage is timed as well for comparison.
+void eval_bench(position_t* p, int reps) {
+  static position_t positions[EVAL_BENCH_PLIES];
+  sortable_move_t moves[MAX_NUM_MOVES];
+  uint32_t rng = 1;
+  int num_positions = 1;
+
+  positions[0] = *p;
+  while (num_positions < EVAL_BENCH_PLIES) {
+    position_t* old = &positions[num_positions - 1];
+    position_t* np = &positions[num_positions];
+    int num_moves = generate_all(old, moves, false);
+    rng = rng * 1103515245 + 12345;
+    int first = (rng >> 8) % num_moves;
+    victims_t victims = ILLEGAL();
+    for (int i = 0; i < num_moves && !zero_victims(victims); i++) {
+      victims = make_move(old, np, get_move(moves[(first + i) % num_moves]));
+      if (is_KO(victims) || is_ILLEGAL(victims) ||
+          (victim_exists(victims) && ptype_of(victims.zapped) == KING)) {
+        victims = ILLEGAL();
+        continue;
+      }
+      break;
+    }
+    if (is_ILLEGAL(victims)) {
+      break;
+    }
+    num_positions++;
+  }
+
+  int saved_cache = COVERAGE_CACHE;
+  uint64_t* saved_table = eval_table;
+  COVERAGE_CACHE = 0;
+  eval_table = NULL;
+  double checksum = 0;
+  double calls = (double) reps * num_positions;
+
+  double start = milliseconds();
+  for (int r = 0; r < reps; r++) {
+    for (int i = 0; i < num_positions; i++) {
+      checksum += eval(&positions[i], false);
+    }
+  }
+  double eval_ms = milliseconds() - start;
+
+  start = milliseconds();
+  for (int r = 0; r < reps; r++) {
+    for (int i = 0; i < num_positions; i++) {
+      checksum += laser_coverage(&positions[i], WHITE);
+      checksum += laser_coverage(&positions[i], BLACK);
+    }
+  }
+  double coverage_ms = milliseconds() - start;
+
+  start = milliseconds();
+  for (int r = 0; r < reps; r++) {
+    for (int i = 0; i < num_positions; i++) {
+      checksum += laser_coverage_ref(&positions[i], WHITE);
+      checksum += laser_coverage_ref(&positions[i], BLACK);
+    }
+  }
+  double ref_ms = milliseconds() - start;
+  COVERAGE_CACHE = saved_cache;
+  eval_table = saved_table;
+
+  printf("info string evalbench %d positions x %d\n", num_positions, reps);
+  printf("info string eval %.0f ns/call\n", eval_ms * 1e6 / calls);
+  printf("info string laser_coverage %.0f ns/call, reference %.0f ns/call (%.2fx)\n",
+         coverage_ms * 1e6 / (2 * calls), ref_ms * 1e6 / (2 * calls),
+         ref_ms / coverage_ms);
+  printf("info string checksum %.3f\n", checksum);
+}
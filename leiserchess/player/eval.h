@@ -4,6 +4,7 @@
 #define EVAL_H
 
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "./move_gen.h"
 #include "./search.h"
@@ -17,6 +18,12 @@ void mark_laser_path(position_t* p, color_t c, char* laser_map,
                      char mark_mask);
 
 score_t eval(position_t* p, bool verbose);
+void eval_bench(position_t* p, int reps);
+
+void eval_hash_resize(int sizeMeg);
+void eval_hash_clear();
+void eval_hash_reset_stats();
+void eval_hash_print_stats(FILE* out);
 
 double pcentral_bonus_lookup[64];
 #endif  // EVAL_H
@@ -383,6 +383,12 @@ int fen_to_pos(position_t* p, char* fen) {
   // King check
   printf("\n");
   int Kings[2] = {0, 0};
+  // pieces the fen leaves out are zapped ones
+  for (int c = 0; c < 2; c++) {
+    for (int i = 0; i < NUM_PIECES_SIDE; i++) {
+      p->pieceLocations[c][i] = -1;
+    }
+  }
   for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
     for (rnk_t r = 0; r < BOARD_WIDTH; ++r) {
       square_t sq = square_of(f, r);
@@ -397,6 +403,8 @@ int fen_to_pos(position_t* p, char* fen) {
       }
     }
   }
+  compute_bitboards(p);
+
   if (Kings[WHITE] == 0) {
     fen_error(fen, c_count, "No White Kings");
     return 1;
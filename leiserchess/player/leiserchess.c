@@ -17,23 +17,27 @@
   #include <cilk/reducer.h>
 #endif
 
+#include "./book.h"
+#include "./end_game.h"
 #include "./eval.h"
 #include "./fen.h"
 #include "./move_gen.h"
 #include "./search.h"
 #include "./tbassert.h"
+#include "./timeman.h"
 #include "./tt.h"
 #include "./util.h"
-#include "./lookup.h"
 
 char  VERSION[] = "1038";
 
 #define MAX_HASH 4096       // 4 GB
-#define INF_TIME 99999999999.0
 #define INF_DEPTH 999       // if user does not specify a depth, use 999
+#define SYNC_SEARCH_TIME 10000.0  // ms a search without its own thread may take
 
-// if the time remain is less than this fraction, dont start the next search iteration
-#define RATIO_FOR_TIMEOUT 0.5
+// Aspiration windows (see aspiration_search)
+int ASPIRATION_DELTA;  // half-width of the first window; 0 searches full width
+int ASPIRATION_WIDEN;  // factor to widen by on failure; 0 opens that side fully
+int ASPIRATION_DEPTH;  // first iteration to use a window at
 
 // -----------------------------------------------------------------------------
 // file I/O
@@ -51,6 +55,13 @@ extern int LMR_R2;
 extern int HMB;
 extern int USE_NMM;
 extern int FUT_DEPTH;
+extern int YBWC_PV;
+extern int YBWC_SCOUT;
+extern int SPLIT_DEPTH;
+extern int SMP_MODE;
+extern int SMP_THREADS;
+extern int MERGE_ORDERING;
+extern int SEARCH_STATS;
 extern int TRACE_MOVES;
 extern int DETECT_DRAWS;
 
@@ -62,13 +73,22 @@ extern int KFACE;
 extern int KAGGRESSIVE;
 extern int MOBILITY;
 extern int LCOVERAGE;
+extern int COVERAGE_CACHE;
+extern int EVAL_HASH;
 
 // defined in move_gen.c
 extern int USE_KO;
+extern int PERFT_HASH;
+
+// defined in timeman.c
+extern int TM_MAX_RATIO;
+extern int TM_STABLE;
 
 // defined in tt.c
 extern int USE_TT;
 extern int HASH;
+extern int TT_HUGEPAGES;
+extern int TT_PREFAULT;
 
 // flag that can be set via uci setoption command that will reset the rng to default
 //   seeds. This is useful for running benchmarks for changes that only impact performance.
@@ -99,6 +119,10 @@ static int_options iopts[] = {
   { "pcentral",           &PCENTRAL,   0.05 * PAWN_EV_VALUE,  -PAWN_EV_VALUE, PAWN_EV_VALUE },
   { "lcoverage",         &LCOVERAGE,   0.16 * PAWN_EV_VALUE,   0,              PAWN_EV_VALUE },
   { "hash",                   &HASH,   16,                    1,              MAX_HASH   },
+  { "tt_hugepages",   &TT_HUGEPAGES,   1,                     0,              1             },
+  { "tt_prefault",     &TT_PREFAULT,   1,                     0,              1             },
+  { "eval_hash",         &EVAL_HASH,   4,                     0,              1024          },
+  { "perft_hash",       &PERFT_HASH,   16,                    0,              1024          },
   { "draw",                   &DRAW,   -0.07 * PAWN_VALUE,    -PAWN_VALUE,    PAWN_VALUE    },
   { "randomize",         &RANDOMIZE,   0,                     0,              PAWN_EV_VALUE },
   { "reset_rng",	 &RESET_RNG,   0,		      0,              1             },
@@ -106,15 +130,75 @@ static int_options iopts[] = {
   { "lmr_r2",               &LMR_R2,   20,                    1,              MAX_NUM_MOVES },
   { "hmb",                     &HMB,   0.03 * PAWN_VALUE,     0,              PAWN_VALUE    },
   { "fut_depth",         &FUT_DEPTH,   3,                     0,              5             },
+  { "ybwc_pv",             &YBWC_PV,   2,                     1,              MAX_NUM_MOVES },
+  { "ybwc_scout",       &YBWC_SCOUT,   2,                     1,              MAX_NUM_MOVES },
+  { "split_depth",     &SPLIT_DEPTH,   2,                     0,              MAX_PLY_IN_SEARCH },
+  { "smp_mode",           &SMP_MODE,   SMP_CILK,              SMP_CILK,       SMP_LAZY      },
+  { "smp_threads",     &SMP_THREADS,   4,                     1,              MAX_WORKERS   },
+  { "merge_ordering", &MERGE_ORDERING, 1,                     0,              1             },
+  { "aspiration_delta", &ASPIRATION_DELTA, 0.35 * PAWN_VALUE, 0,              PAWN_VALUE * 10 },
+  { "aspiration_widen", &ASPIRATION_WIDEN, 4,                 0,              16            },
+  { "aspiration_depth", &ASPIRATION_DEPTH, 4,                 2,              INF_DEPTH     },
+  { "tm_max_ratio",   &TM_MAX_RATIO,   3,                     1,              10            },
+  { "tm_stable",         &TM_STABLE,   3,                     1,              INF_DEPTH     },
   // debug options
   { "use_nmm",             &USE_NMM,   1,                     0,              1             },
   { "detect_draws",   &DETECT_DRAWS,   1,                     0,              1             },
   { "use_tt",               &USE_TT,   1,                     0,              1             },
+  { "coverage_cache", &COVERAGE_CACHE, 1,                     0,              1             },
   { "use_ko",               &USE_KO,   1,                     0,              1             },
   { "trace_moves",     &TRACE_MOVES,   0,                     0,              1             },
+  { "search_stats",   &SEARCH_STATS,   0,                     0,              1             },
   { "",                        NULL,   0,                     0,              0             }
 };
 
+// struct for string options (file names)
+typedef struct {
+  char      name[MAX_CHARS_IN_TOKEN];   // name of options
+  char*     var;        // buffer of MAX_CHARS_IN_PATH chars holding its value
+  char*     dfault;     // default value
+} string_options;
+
+// book.bin next to the executable, set up in main()
+static char default_book_file[MAX_CHARS_IN_PATH];
+
+static string_options sopts[] = {
+  // name                  variable    default
+  // -----------------------------------------
+  { "bookfile",            BOOK_FILE,  default_book_file },
+  { "tbpath",              TB_PATH,    ""      },
+  { "",                    NULL,       NULL    }
+};
+
+// Acts on string option opt having been set
+static void apply_string_option(string_options* opt) {
+  if (opt->var == BOOK_FILE) {
+    if (!book_load(BOOK_FILE)) {
+      printf("info string no opening book loaded\n");
+    } else {
+      printf("info string opening book of %" PRIu64 " moves loaded\n",
+             book_loaded_entries());
+    }
+  }
+  if (opt->var == TB_PATH) {
+    if (!tb_load(TB_PATH)) {
+      printf("info string no tablebase loaded\n");
+    } else if (tb_loaded_entries() > 0) {
+      printf("info string tablebase of %" PRIu64 " positions loaded\n",
+             tb_loaded_entries());
+    }
+  }
+}
+
+// True if paths a and b name the same file, however each is spelled
+static bool same_file(const char* a, const char* b) {
+  struct stat sa, sb;
+  if (stat(a, &sa) != 0 || stat(b, &sb) != 0) {
+    return strcmp(a, b) == 0;
+  }
+  return sa.st_dev == sb.st_dev && sa.st_ino == sb.st_ino;
+}
+
 // -----------------------------------------------------------------------------
 // Printing helpers
 // -----------------------------------------------------------------------------
@@ -172,212 +256,122 @@ typedef enum {
 static move_t bestMoveSoFar;
 static char theMove[MAX_CHARS_IN_MOVE];
 
-static pthread_mutex_t entry_mutex;
 static uint64_t node_count_serial;
 
 typedef struct {
   position_t* p;
   int depth;
-  double tme;
 } entry_point_args;
 
 typedef struct {
-  char *lookup_best_move;
+  move_t book_move;  // 0 unless the move came from the opening book
 } entry_point_ret;
 
-static const uint64_t SORT_MASK = (1ULL << 32) - 1;
-static const int SORT_SHIFT = 32;
-
-void set_move_score(sortable_move_t* move, int score){
-    *move = ((score & SORT_MASK) << 32) | (*move & ~(SORT_MASK << 32));
-}
-
-int get_move_score(sortable_move_t* move){
-  return (*move >> 32) & 4294967295;
-}
-
-// Insertion sort of the move list.
-void score_sort(sortable_move_t* move_list, int num_of_moves, int mv_index) {
-  for (int j = 0; j < num_of_moves; j++) {
-    sortable_move_t insert = move_list[j];
-    int hole = j;
-    int32_t insertScore = get_move_score(&insert);
-    int32_t holeScore = get_move_score(&move_list[hole-1]);
-    while (hole > 0 && insertScore > holeScore) {
-      move_list[hole] = move_list[hole - 1];
-      hole--;
-      holeScore = get_move_score(&move_list[hole-1]);
-    }
-    move_list[hole] = insert;
+// The search runs on a thread of its own, so that the UCI loop can take stop
+// and ponderhit while it runs.  Only the UCI loop starts and joins it.
+static pthread_t search_thread;
+static bool search_running = false;
+static entry_point_args search_args;
+
+// While pondering (go ponder, or go infinite), the search thread holds back
+// its bestmove until the UCI loop says stop or ponderhit.
+static pthread_mutex_t ponder_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ponder_cond = PTHREAD_COND_INITIALIZER;
+static bool pondering = false;
+// Set on ponderhit with a timed clock, until the search thread goes on it
+static bool ponderhit = false;
+
+// The clock of the last go command, for the time manager to start from on
+// ponderhit.
+static bool   clock_timed;
+static double clock_time;
+static double clock_inc;
+
+// Searches p to depth within a window around the previous iteration's score,
+// prev, widening the window on the side it fails on until the score lands
+// inside.  When the window fails low, searchRoot leaves pv alone, so the best
+// move so far stays the previous iteration's.
+//
+// https://www.chessprogramming.org/Aspiration_Windows
+static score_t aspiration_search(rootState_t* root, position_t* p,
+                                 score_t prev, int depth, move_t* pv) {
+  if (ASPIRATION_DELTA == 0 || depth < ASPIRATION_DEPTH) {
+    return searchRoot(root, p, -INF, INF, depth, 0, pv, &node_count_serial,
+                      OUT);
   }
-}
 
-move_t findBestMove(position_t*p, int searchDepth, color_t whosTurn){
-  position_t newP;
-  uint64_t nodeCount = 0;
-  newP = *p;
-  move_t subpv[MAX_PLY_IN_SEARCH];
-  for(int d = 1; d < searchDepth; d++){
-    reset_abort();
-    score_t newScore = searchRoot(&newP, -INF, INF, d, 0, subpv, &nodeCount, OUT);
-  }
-  move_t bestMove = subpv[0];
-  return bestMove;
-}
+  int delta = ASPIRATION_DELTA;
+  int alpha = prev - delta > -INF ? prev - delta : -INF;
+  int beta = prev + delta < INF ? prev + delta : INF;
 
-
-void openbook_helper(position_t* p, int depth, move_t* previousMoves, int numPreviousMoves, color_t whosTurn, int startDepth){
-  int searchDepth = 4;
-  int numMovesToTake = 5;
-  // if (depth == startDepth){
-  //   numMovesToTake = 60;
-  // }
-  // printf("Depth: %d  numPreviousMoves: %d\n", depth, numPreviousMoves);
-  if (depth == 0){
-    char buf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
-    int bufsize = (MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
-    printf("\"");
-    for (int i = 0; i < numPreviousMoves; i++){
-      char a[MAX_CHARS_IN_MOVE];
-      move_to_str(previousMoves[i], a, MAX_CHARS_IN_MOVE);
-      printf("%s", a);
-    }
-    move_t nextMove = findBestMove(p, 6, 0);
-    char newBuf[MAX_CHARS_IN_MOVE];
-    move_to_str(nextMove, newBuf, MAX_CHARS_IN_MOVE);
-    printf("\", \"%s\", ", newBuf);
-  } else {
-    sortable_move_t move_list[MAX_NUM_MOVES];
-    uint64_t nodeCount = 0;
-    int numMoves = generate_all_with_color(p, move_list, whosTurn);
-    position_t newP;
-    for (int i = 0; i < numMoves; i++){
-      move_t mv = get_move(move_list[i]);
-      make_move(p, &newP, mv);
-      move_t subpv[MAX_PLY_IN_SEARCH];
-      score_t bestScore = 0;
-      for(int d = 1; d < searchDepth; d++){
-        reset_abort();
-        score_t newScore = searchRoot(&newP, -INF, INF, d, 0, subpv, &nodeCount, OUT);
-        set_move_score(&(move_list[i]), newScore);
-        if (d == 1 || newScore > bestScore){
-          bestScore = newScore;
-        }
-      }
-      move_t bestMove = subpv[0];
-    }
-    score_sort(move_list, numMoves, 0);
-    for (int mInd = numMoves-1; mInd >numMoves-1-numMovesToTake; mInd--){
-      move_t newPreviousMoves[numPreviousMoves+1];
-      for (int i = 0; i < numPreviousMoves; i++){
-        newPreviousMoves[i] = previousMoves[i];
-      }
-      newPreviousMoves[numPreviousMoves] = move_list[mInd];
-      position_t newP;
-      make_move(p, &newP, move_list[mInd]);
-      color_t newColor = 0;
-      if (whosTurn == 0){
-        newColor = 1;
-      }
-      cilk_spawn openbook_helper(&newP, depth-1, newPreviousMoves, numPreviousMoves+1, newColor, startDepth);
+  while (true) {
+    score_t score = searchRoot(root, p, alpha, beta, depth, 0, pv,
+                               &node_count_serial, OUT);
+    if (should_abort() || (alpha < score && score < beta)) {
+      return score;
     }
-    cilk_sync;
-  }
-}
-
-void generate_openbook(position_t* p){
-  move_t previousMoves[1];
-  int numPreviousMoves = 0;
-  init_abort_timer(30000000);
-  printf("{");
-  openbook_helper(p, 5, previousMoves, numPreviousMoves, WHITE, 5);
-  printf("}");
-}
-
-
-
-// Returns the `best_move` if found starting from a 
-// given position `p`. Otherwise returns NULL
-char* try_lookup_table(position_t* p) {
-  char *best_move = NULL;
-
-  move_t moves[OPEN_BOOK_DEPTH] = {0};
-  char move_list[OPEN_BOOK_DEPTH * 10] = {0};
-
-  // Extract history from `p`
-  position_t* current_move = p;
-  for (int move_index = p->ply; move_index > 0; move_index--) {
-    move_t tail = current_move->last_move;
-    moves[move_index - 1] = tail;
-    current_move = current_move->history;
-  }
 
-  // Convert to human readable index. Ie: "move1move2move3"
-  for (int move_index = 0; move_index < p->ply; move_index++) {
-    char hr_move[10];
-    move_to_str(moves[move_index], hr_move, 10);
-    strcat(move_list, hr_move);
-  }
-
-  // Search the table for this index
-  char** table = lookup_tables[p->ply];
-  int table_size = lookup_sizes[p->ply];
-  for (size_t i = 0; i < table_size; i += 2) {
-    if (strcmp(move_list, table[i]) == 0) {
-      best_move = table[i + 1];
-      
-      // wow, such speed, much depth!
-      fprintf(OUT, "info depth +inf move_no 1 time (microsec) 0 nodes +inf nps +inf\n");
-      
-      // This unlock will allow the main thread lock/unlock in
-      // UCIBeginSearch to proceed
-      pthread_mutex_unlock(&entry_mutex);
-      break;
+    delta = delta * ASPIRATION_WIDEN;
+    if (score <= alpha) {
+      tm_fail_low(depth);
+      alpha = (delta > 0 && score - delta > -INF) ? score - delta : -INF;
+    } else {
+      beta = (delta > 0 && score + delta < INF) ? score + delta : INF;
     }
   }
-  
-  return best_move;
 }
 
-void entry_point(entry_point_args* args, entry_point_ret* ret) {
-  move_t subpv[MAX_PLY_IN_SEARCH];
+static void iterative_deepening(position_t* p, int depth);
 
+void entry_point(entry_point_args* args, entry_point_ret* ret) {
   int depth = args->depth;
   position_t* p = args->p;
-  double tme = args->tme;
-
-  double et = 0.0;
-
-
-  // generate_openbook(p);
-
-  // start time of search
-  init_abort_timer(tme);
 
   init_best_move_history();
   tt_age_hashtable();
 
   init_tics();
 
-  // Try using the move lookup table if our ply is less than the depth of the table
-  if (p->ply < OPEN_BOOK_DEPTH) {
-    char *lookup_best_move = try_lookup_table(p);
-    
-    // A best move from the lookup table was found. Return immediately!
-    if (lookup_best_move) {
-      ret->lookup_best_move = lookup_best_move;
-      return;
-    }
+  // Play from the opening book if it knows the position
+  move_t book_move = book_probe(p);
+  if (book_move != 0) {
+    char bms[MAX_CHARS_IN_MOVE];
+    move_to_str(book_move, bms, MAX_CHARS_IN_MOVE);
+    fprintf(OUT, "info string book move %s\n", bms);
+    ret->book_move = book_move;
+    bestMoveSoFar = book_move;
+    return;
   }
 
+  iterative_deepening(p, depth);
+  return;
+}
+
+// Searches p one ply deeper at a time, up to depth plies or until the time
+// manager or an abort says stop, leaving the best move in bestMoveSoFar.
+static void iterative_deepening(position_t* p, int depth) {
+  move_t subpv[MAX_PLY_IN_SEARCH];
+  double et = 0.0;
+
+  // Lazy SMP helpers, if any, search alongside
+  int helpers = smp_start_helpers(p, depth);
+
   // Iterative deepening
+  rootState_t root = { .key = 0 };  // no moves yet: searchRoot generates them
+  score_t score = 0;
   for (int d = 1; d <= depth; d++) {
     reset_abort();
 
     // Unleash wrath!
-    searchRoot(p, -INF, INF, d, 0, subpv, &node_count_serial, OUT);
+    score = aspiration_search(&root, p, score, d, subpv);
+    run_search_task();
+    if (helpers == 0) {
+      // helpers write their tables all along: merge once they have stopped
+      merge_move_ordering();
+    }
     et = elapsed_time();
     bestMoveSoFar = subpv[0];
+    search_stats_iteration(d, et, should_abort(), OUT);
 
     if (!should_abort()) {
       // print something?
@@ -386,46 +380,245 @@ void entry_point(entry_point_args* args, entry_point_ret* ret) {
     }
 
     // don't start iteration that you cannot complete
-    if (et > tme * RATIO_FOR_TIMEOUT) {
+    if (!tm_continue(d, bestMoveSoFar, score, et)) {
       break;
     }
   }
-
-  // This unlock will allow the main thread lock/unlock in UCIBeginSearch to
-  // proceed
-  pthread_mutex_unlock(&entry_mutex);
+  node_count_serial += smp_stop_helpers();
+  if (helpers > 0) {
+    merge_move_ordering();
+  }
 
   return;
 }
 
-// Makes call to entry_point -> make call to searchRoot -> searchRoot in search.c
-void UciBeginSearch(position_t* p, int depth, double tme) {
-  // Setup for the barrier
-  pthread_mutex_lock(&entry_mutex);
+// Body of the search thread: makes call to entry_point -> make call to
+// searchRoot -> searchRoot in search.c, and reports the move found.
+static void* search_thread_main(void* arg) {
+  entry_point_args* args = (entry_point_args*) arg;
+  entry_point_ret ret;
 
-  entry_point_args args;
-  args.depth = depth;
-  args.p = p;
-  args.tme = tme;
-  node_count_serial = 0;
+  set_search_thread();
+  ret.book_move = 0;
+  eval_hash_reset_stats();
+  search_stats_reset();
+  entry_point(args, &ret);
+
+  // UCI forbids a bestmove before stop or ponderhit while pondering, even if
+  // the search is over.
+  pthread_mutex_lock(&ponder_mutex);
+  while (pondering) {
+    pthread_cond_wait(&ponder_cond, &ponder_mutex);
+  }
+  pthread_mutex_unlock(&ponder_mutex);
 
-  entry_point_ret ret;
+  if (ret.book_move == 0) {
+    eval_hash_print_stats(OUT);
+  }
+  char bms[MAX_CHARS_IN_MOVE];
+  move_to_str(bestMoveSoFar, bms, MAX_CHARS_IN_MOVE);
+  snprintf(theMove, MAX_CHARS_IN_MOVE, "%s", bms);
+  fprintf(OUT, "bestmove %s\n", bms);
+  return NULL;
+}
 
-  // If non-NULL, means that lookup table was used to determine best move
-  ret.lookup_best_move = NULL;
-  entry_point(&args, &ret);
+// Starts searching p on the search thread, for at most depth plies, and on
+// the clock (time_left and inc) if timed.  When ponder is set, the search
+// runs until stop, or until ponderhit, after which it goes on the clock.
+void UciBeginSearch(position_t* p, int depth, bool timed, double time_left,
+                    double inc, bool ponder) {
+  search_args.depth = depth;
+  search_args.p = p;
+  node_count_serial = 0;
 
-  // Check if `entry_point` found a best move using the lookup table
-  if (ret.lookup_best_move) {
-    fprintf(OUT, "bestmove %s\n", ret.lookup_best_move);
+  pondering = ponder;
+  ponderhit = false;
+  clock_timed = timed;
+  clock_time = time_left;
+  clock_inc = inc;
+
+  if (timed && !ponder) {
+    tm_start(OUT, time_left, inc);
   } else {
+    tm_start_unlimited();
+  }
+  // start time of search; set before the thread starts, so that an early stop
+  // is not lost
+  init_abort_timer(tm_maximum());
+
+  if (pthread_create(&search_thread, NULL, search_thread_main,
+                     &search_args) != 0) {
+    // Search on this thread instead.  Nothing reads stop or ponderhit until
+    // the search is over, so it must end on its own: on the clock, if there
+    // is one, and never later than SYNC_SEARCH_TIME.
+    if (ponder) {
+      fprintf(OUT, "info string no search thread, searching without "
+              "pondering\n");
+      pondering = false;
+      if (timed) {
+        tm_start(OUT, time_left, inc);
+      }
+      init_abort_timer(timed ? tm_maximum() : SYNC_SEARCH_TIME);
+    }
+    search_thread_main(&search_args);
+    return;
+  }
+  search_running = true;
+}
+
+// Lets the search thread report its move: the opponent played the move
+// pondered on (ponderhit), or the GUI wants the move now (stop).
+static void end_ponder() {
+  pthread_mutex_lock(&ponder_mutex);
+  pondering = false;
+  pthread_cond_signal(&ponder_cond);
+  pthread_mutex_unlock(&ponder_mutex);
+}
+
+// Stops the search, if one is running, and waits for its bestmove.
+static void UciStopSearch() {
+  if (search_running) {
+    // a clock the search thread has yet to go on must not undo the stop
+    pthread_mutex_lock(&ponder_mutex);
+    ponderhit = false;
+    pthread_mutex_unlock(&ponder_mutex);
+    stop_search();
+    end_ponder();
+    pthread_join(search_thread, NULL);
+    search_running = false;
+  }
+}
+
+// Waits for the search, if one is running, to finish on its own, stopping it
+// only if it never would (pondering or go infinite).
+static void UciWaitSearch() {
+  if (search_running) {
+    if (pondering) {
+      UciStopSearch();
+      return;
+    }
+    pthread_join(search_thread, NULL);
+    search_running = false;
+  }
+}
+
+// Puts the search on the clock of the last go command after a ponderhit.  Runs
+// on the search thread (see post_search_task()), which alone uses the time
+// manager and restarts the abort timer.
+static void start_ponderhit_clock() {
+  pthread_mutex_lock(&ponder_mutex);
+  if (ponderhit) {
+    ponderhit = false;
+    tm_start(OUT, clock_time, clock_inc);
+    init_abort_timer(tm_maximum());
+  }
+  pthread_mutex_unlock(&ponder_mutex);
+}
+
+// The opponent played the move we pondered on: the search goes on, but now on
+// our own clock, which the search thread starts at its next check.
+static void UciPonderHit() {
+  if (search_running && pondering) {
+    if (clock_timed) {
+      pthread_mutex_lock(&ponder_mutex);
+      ponderhit = true;
+      pthread_mutex_unlock(&ponder_mutex);
+      post_search_task(start_ponderhit_clock);
+    }
+    end_ponder();
+  }
+}
+
+// -----------------------------------------------------------------------------
+// bench
+// -----------------------------------------------------------------------------
+
+// Openings, middlegames and endgames, taken from games the engine played
+// against itself.
+static char* bench_fens[] = {
+  "ss7/2nwnwse3/3se4/2se5/5SESW1/5NW2/1ne1nwNWNE2/3SE3NN W",
+  "ee7/3nwsw3/2nwse4/1sw3SENW1/2seNW1NW2/5SW2/2se1SE3/2NE4WW W",
+  "1ss6/3swse3/2nwse4/2NW3NW1/2NWnw1NWSE1/2ne2SE2/3seNE2WW/8 W",
+  "8/ee2nwsw3/3se2SW1/1nw1ne4/3ne1SW1NW/2se1NWSE2/3NWSE3/6NN1 W",
+  "ss7/2nwnwse3/3SE2seSW/NW1se5/4NW3/1ne6/3NE1NE2/3se3NN W",
+  "8/3NWsw3/2ee5/1ne1SWnwNENW1/3nwse3/1SE3SW2/2NEse4/2se2WW2 W",
+  "8/1ssnw2SW2/2ne2se1SW/1NW2se3/1ne1NE2sw1/NW4SE2/4SE1NN1/8 W",
+  "1ss6/2swsese3/2nw5/2neSWSW1NW1/2ne3SE1/4SE3/2ne1NWNE1WW/8 W",
+  "8/2nwnw4/3nwNW3/2ss1nwSWSE1/se2SE4/ne3NWSE2/2nw1SE1NN1/8 W",
+  "ss7/4SE1SW1/NW3se3/2SWnw4/ne3NN3/1seNE5/5SW2/3se4 W",
+  "3NW4/2ss5/5sw2/2ne1nw3/4NW1NE1/1NESE3WW1/8/nw3se3 W",
+  "2ss3SW1/6se1/2nenw4/1ne3SW2/1NE1NE1SWsw1/NW2NN1SE2/5ne2/8 W",
+  "8/ee1nwsw4/3NW4/3ne2SW1/NE2se3sw/3SE2SW1/2NE5/6NN1 W",
+  "8/4ee3/6sw1/3nw1NE2/6NE1/1NESE1SEWW1se/8/nw7 B",
+  "1ss4SW1/6se1/2ne5/1NW1nw1SWSW1/1NW2NN1NW1/ne4SE2/5sw2/8 B",
+  NULL
+};
+
+// Searches every bench position to depth and reports nodes, time, nodes per
+// second and a signature of the node counts.  Each search starts from a clean
+// slate (empty tables, reset random numbers, no eval noise), so that the
+// signature only changes when the search does.  It is reproducible with a
+// single worker in SMP_CILK mode.
+static void bench(int depth) {
+  FILE* out = OUT;
+  int randomize = RANDOMIZE;
+  uint64_t total_nodes = 0;
+  uint64_t signature = 0xcbf29ce484222325ULL;  // FNV-1a
+
+  // Zobrist keys come from the random number generator too.  The game's own
+  // keys are put back afterwards, as the positions in gme[] were hashed with
+  // them.
+  zobKeys_t game_keys;
+  save_zob(&game_keys);
+  RANDOMIZE = 0;
+  reset_rng();
+  init_zob();
+  search_stats_reset();
+
+  double start = milliseconds();
+  for (int i = 0; bench_fens[i] != NULL; i++) {
+    position_t p;
+    if (fen_to_pos(&p, bench_fens[i]) != 0) {
+      fprintf(out, "info string bench position %d is bad\n", i + 1);
+      continue;
+    }
+
+    tt_clear_hashtable();
+    eval_hash_clear();
+    clear_move_ordering();
+    reset_rng();
+    init_tics();
+    node_count_serial = 0;
+    tm_start_unlimited();
+    init_abort_timer(tm_maximum());
+
+    OUT = NULL;  // keep the iterations quiet
+    iterative_deepening(&p, depth);
+    OUT = out;
+
     char bms[MAX_CHARS_IN_MOVE];
     move_to_str(bestMoveSoFar, bms, MAX_CHARS_IN_MOVE);
-    snprintf(theMove, MAX_CHARS_IN_MOVE, "%s", bms);
-    fprintf(OUT, "bestmove %s\n", bms);
+    fprintf(out, "info string bench position %d nodes %" PRIu64 " bestmove %s\n",
+            i + 1, node_count_serial, bms);
+
+    total_nodes += node_count_serial;
+    for (int b = 0; b < 8; b++) {
+      signature ^= (node_count_serial >> (8 * b)) & 0xff;
+      signature *= 0x100000001b3ULL;
+    }
+  }
+  double et = milliseconds() - start;
+  if (et < 1) {
+    et = 1;
   }
 
-  return;
+  RANDOMIZE = randomize;
+  restore_zob(&game_keys);
+  tt_clear_hashtable();  // drop entries stored under the bench keys
+  eval_hash_clear();
+  fprintf(out, "info string bench depth %d nodes %" PRIu64 " time %.0f nps %"
+          PRIu64 " signature %016" PRIx64 "\n", depth, total_nodes, et,
+          (uint64_t) (1000 * total_nodes / et), signature);
 }
 
 // -----------------------------------------------------------------------------
@@ -435,6 +628,21 @@ void UciBeginSearch(position_t* p, int depth, double tme) {
 // print help messages in uci
 void help()  {
   printf("eval      - Evaluate current position.\n");
+  printf("evalbench - Time the static evaluator on positions played out from the\n");
+  printf("            current one.  Takes an optional repetition count (default 1000).\n");
+  printf("bench     - Search a fixed set of positions and report nodes, time, nps\n");
+  printf("            and a node count signature.  Takes an optional depth\n");
+  printf("            (default 3).  Resets the random number generator, like\n");
+  printf("            setoption name reset_rng.\n");
+  printf("bookgen   - Generate an opening book from the current position, searching\n");
+  printf("            each book position to a fixed depth on smp_threads threads.\n");
+  printf("            Takes a file name, then optionally the plies to grow the book\n");
+  printf("            to (default 8), the search depth (6), the moves to keep per\n");
+  printf("            position (3), and how much worse than the best one they may\n");
+  printf("            score (50).  Progress is saved to <file>.ckpt after every ply,\n");
+  printf("            and the same command carries on from there.\n");
+  printf("            Sample usage: \n");
+  printf("                bookgen book.bin 10 8: a 10-ply book searched to depth 8\n");
   printf("display   - Display current board state.\n");
   printf("generate  - Generate all possible moves.\n");
   printf("go        - Search from current state.  Possible arguments are:\n");
@@ -442,7 +650,11 @@ void help()  {
   printf("            time <time_limit>: search assume you have <time> amount of time\n");
   printf("                               for the whole game.\n");
   printf("            inc <time_inc>:    set the fischer time increment for the search\n");
+  printf("            ponder:            search on the opponent's time until ponderhit\n");
+  printf("            infinite:          search until stop\n");
   printf("            Both time arguments are specified in milliseconds.\n");
+  printf("            The search runs in the background; commands other than\n");
+  printf("            isready, stop and ponderhit wait for it to finish.\n");
   printf("            Sample usage: \n");
   printf("                go depth 4: search until depth 4\n");
   printf("help      - Display help (this info).\n");
@@ -451,10 +663,13 @@ void help()  {
   printf("move      - Make a move for current player.\n");
   printf("            Sample usage: \n");
   printf("                move j0j1: move a piece from j0 to j1\n");
+  printf("ponderhit - The opponent played the move pondered on: keep searching, on\n");
+  printf("            our own time now.\n");
   printf("perft     - Output the number of possible moves upto a given depth.\n");
   printf("            Used to verify move the generator.\n");
   printf("            Sample usage: \n");
   printf("                depth 3: generate all possible moves for depth 1--3\n");
+  printf("                depth 3 divide: also output the count of each first move\n");
   printf("position  - Set up the board using the fenstring given.  Possible arguments are:\n");
   printf("            startpos:     set up the board with default starting position.\n");
   printf("            endgame:      set up the board with endgame configuration.\n");
@@ -468,6 +683,14 @@ void help()  {
   printf("            Use the comment \"uci\" to see possible options and their current values\n");
   printf("            Sample usage: \n");
   printf("                setoption name fut_depth value 4: set fut_depth to 4\n");
+  printf("                setoption name bookfile value book.bin: play from the opening book in book.bin\n");
+  printf("                setoption name tbpath value kkp.tb: probe the tablebase in kkp.tb\n");
+  printf("stats     - Write the search statistics of the last search (or bench), one\n");
+  printf("            line per depth, as CSV.  Needs the search_stats option.\n");
+  printf("            Sample usage: \n");
+  printf("                stats: write them to the screen\n");
+  printf("                stats lmr.csv: write them to the file lmr.csv\n");
+  printf("stop      - Stop searching and report the best move found so far.\n");
   printf("uci       - Display UCI version and options\n");
   printf("\n");
 }
@@ -565,6 +788,9 @@ void init_options() {
              "max: %d, dfault: %d\n", iopts[j].max, iopts[j].dfault);
     *iopts[j].var = iopts[j].dfault;
   }
+  for (int j = 0; sopts[j].name[0] != 0; j++) {
+    snprintf(sopts[j].var, MAX_CHARS_IN_PATH, "%s", sopts[j].dfault);
+  }
 }
 
 void print_options() {
@@ -576,6 +802,12 @@ void print_options() {
            iopts[j].min,
            iopts[j].max);
   }
+  for (int j = 0; sopts[j].name[0] != 0; j++) {
+    printf("option name %s type string value %s default %s\n",
+           sopts[j].name,
+           sopts[j].var[0] ? sopts[j].var : "<empty>",
+           sopts[j].dfault[0] ? sopts[j].dfault : "<empty>");
+  }
   return;
 }
 
@@ -598,8 +830,11 @@ int main(int argc, char* argv[]) {
     IN = stdin;
   }
 
+  init_workers();
+  book_default_file(default_book_file, sizeof(default_book_file));
   init_options();
   init_zob();
+  init_bitboards();
 
   char** tok = (char**) malloc(sizeof(char*) * MAX_CHARS_IN_TOKEN * MAX_PLY_IN_GAME);
   int   ix = 0;  // index of which position we are operating on
@@ -610,6 +845,10 @@ int main(int argc, char* argv[]) {
 
 
   tt_make_hashtable(HASH);   // initial hash table
+  eval_hash_resize(EVAL_HASH);
+  if (!book_load(BOOK_FILE)) {
+    printf("info string no opening book at %s\n", BOOK_FILE);
+  }
   fen_to_pos(&gme[ix], "");  // initialize with an actual position
 
   //  Check to make sure we don't loop infinitely if we don't get input.
@@ -632,6 +871,25 @@ int main(int argc, char* argv[]) {
         saw_input = true;
       }
 
+      // Only these commands are taken while the search thread runs.  Any
+      // other waits for the search to end first.
+      if (strcmp(tok[0], "stop") == 0) {
+        UciStopSearch();
+        continue;
+      }
+
+      if (strcmp(tok[0], "ponderhit") == 0) {
+        UciPonderHit();
+        continue;
+      }
+
+      if (strcmp(tok[0], "isready") == 0) {
+        printf("readyok\n");
+        continue;
+      }
+
+      UciWaitSearch();
+
       if (strcmp(tok[0], "quit") == 0) {
         break;
       }
@@ -717,18 +975,13 @@ int main(int argc, char* argv[]) {
         continue;
       }
 
-      if (strcmp(tok[0], "isready") == 0) {
-        printf("readyok\n");
-        continue;
-      }
-
       if (strcmp(tok[0], "setoption") == 0) {
         int sostate = 0;
         char  name[MAX_CHARS_IN_TOKEN];
-        char  value[MAX_CHARS_IN_TOKEN];
+        char  value[MAX_CHARS_IN_PATH];  // string options take file names
 
         strncpy(name, "", MAX_CHARS_IN_TOKEN);
-        strncpy(value, "", MAX_CHARS_IN_TOKEN);
+        strncpy(value, "", MAX_CHARS_IN_PATH);
 
         for (int i = 1; i < token_count; i++) {
           if (strcmp(tok[i], "name") == 0) {
@@ -748,11 +1001,11 @@ int main(int argc, char* argv[]) {
           }
 
           if (sostate == 2) {
-            strncat(value, " ", MAX_CHARS_IN_TOKEN - strlen(value) - 1);
-            strncat(value, tok[i], MAX_CHARS_IN_TOKEN - strlen(value) - 1);
+            strncat(value, " ", MAX_CHARS_IN_PATH - strlen(value) - 1);
+            strncat(value, tok[i], MAX_CHARS_IN_PATH - strlen(value) - 1);
             if (i + 1 < token_count) {
-              strncat(value, " ", MAX_CHARS_IN_TOKEN - strlen(value) - 1);
-              strncat(value, tok[i + 1], MAX_CHARS_IN_TOKEN - strlen(value) - 1);
+              strncat(value, " ", MAX_CHARS_IN_PATH - strlen(value) - 1);
+              strncat(value, tok[i + 1], MAX_CHARS_IN_PATH - strlen(value) - 1);
               i++;
             }
             continue;
@@ -760,6 +1013,25 @@ int main(int argc, char* argv[]) {
         }
 
         lower_case(name);
+
+        // see if option is in the string parameters, which keep their case
+        {
+          bool recognized = false;
+          for (int j = 0; sopts[j].name[0] != 0; j++) {
+            if (strcmp(name + 1, sopts[j].name) == 0) {
+              recognized = true;
+              snprintf(sopts[j].var, MAX_CHARS_IN_PATH, "%s",
+                       value[0] ? value + 1 : "");
+              printf("info setting %s to %s\n", sopts[j].name, sopts[j].var);
+              apply_string_option(&sopts[j]);
+              break;
+            }
+          }
+          if (recognized) {
+            continue;
+          }
+        }
+
         lower_case(value);
 
         // see if option is in the configurable integer parameters
@@ -782,14 +1054,21 @@ int main(int argc, char* argv[]) {
               printf("info setting %s to %d\n", iopts[j].name, v);
               *(iopts[j].var) = v;
 
-              if (strcmp(name + 1, "hash") == 0) {
+              if (strcmp(name + 1, "hash") == 0 ||
+                  strcmp(name + 1, "tt_hugepages") == 0) {
                 tt_resize_hashtable(HASH);
                 printf("info string Hash table set to %d records of "
                        "%zu bytes each\n",
                        tt_get_num_of_records(), tt_get_bytes_per_record());
-                printf("info string Total hash table size: %zu bytes\n",
-                       tt_get_num_of_records() * tt_get_bytes_per_record());
+                printf("info string Total hash table size: %zu bytes%s\n",
+                       tt_get_num_of_records() * tt_get_bytes_per_record(),
+                       tt_uses_hugepages() ? " (huge pages)" : "");
               }
+              if (strcmp(name + 1, "eval_hash") == 0) {
+                eval_hash_resize(EVAL_HASH);
+              }
+              // cached scores may depend on the option just set
+              eval_hash_clear();
               if (strcmp(name + 1, "reset_rng") == 0) {
                 printf("info string reset the rng\n");
                 // if setting the random seed we need to reinit the zob
@@ -844,11 +1123,21 @@ int main(int argc, char* argv[]) {
         continue;
       }
 
+      if (strcmp(tok[0], "evalbench") == 0) {
+        int reps = 1000;
+        if (token_count >= 2) {
+          reps = strtol(tok[1], (char**)NULL, 10);
+        }
+        eval_bench(&gme[ix], reps > 0 ? reps : 1);
+        continue;
+      }
+
       if (strcmp(tok[0], "go") == 0) {
         double tme = 0.0;
         double inc = 0.0;
         int    depth = INF_DEPTH;
-        double goal = INF_TIME;
+        bool   ponder = false;
+        bool   infinite = false;
 
         // process various tokens here
         for (int n = 1; n < token_count; n++) {
@@ -867,19 +1156,71 @@ int main(int argc, char* argv[]) {
             inc = strtod(tok[n], (char**)NULL);
             continue;
           }
+          if (strcmp(tok[n], "ponder") == 0) {
+            ponder = true;
+            continue;
+          }
+          if (strcmp(tok[n], "infinite") == 0) {
+            infinite = true;
+            continue;
+          }
         }
 
-        if (depth < INF_DEPTH) {
-          UciBeginSearch(&gme[ix], depth, INF_TIME);
-        } else {
-          goal = tme * 0.02;   // use about 1/50 of main time
-          goal += inc * 0.80;  // use most of increment
-          // sanity check,  make sure that we don't run ourselves too low
-          if (goal * 10 > tme) {
-            goal = tme / 10.0;
+        bool timed = !infinite && depth == INF_DEPTH;
+        UciBeginSearch(&gme[ix], depth, timed, tme, inc, ponder || infinite);
+        continue;
+      }
+
+      if (strcmp(tok[0], "stats") == 0) {
+        FILE* csv = stdout;
+        if (token_count >= 2) {
+          csv = fopen(tok[1], "w");
+          if (csv == NULL) {
+            printf("info string cannot write %s\n", tok[1]);
+            continue;
+          }
+        }
+        search_stats_dump(csv);
+        if (csv != stdout) {
+          fclose(csv);
+        }
+        continue;
+      }
+
+      if (strcmp(tok[0], "bookgen") == 0) {
+        if (token_count < 2) {
+          printf("info string bookgen needs a file name\n");
+          continue;
+        }
+        // plies, depth, width and margin, in that order (see bookgen.c)
+        int args[4] = { 8, 6, 3, PAWN_VALUE / 2 };
+        const int max[4] = { BOOKGEN_MAX_PLIES, MAX_PLY_IN_SEARCH / 2,
+                             BOOKGEN_MAX_WIDTH, INF };
+        for (int i = 0; i < 4; i++) {
+          if (i + 2 < token_count) {
+            args[i] = strtol(tok[i + 2], (char**)NULL, 10);
           }
-          UciBeginSearch(&gme[ix], INF_DEPTH, goal);
+          if (args[i] < (i < 3 ? 1 : 0)) {
+            args[i] = i < 3 ? 1 : 0;
+          }
+          if (args[i] > max[i]) {
+            args[i] = max[i];
+          }
+        }
+        if (book_generate(&gme[ix], tok[1], args[0], args[1], args[2], args[3],
+                          OUT) &&
+            same_file(tok[1], BOOK_FILE)) {
+          book_load(BOOK_FILE);  // play from the new book straight away
+        }
+        continue;
+      }
+
+      if (strcmp(tok[0], "bench") == 0) {
+        int depth = 3;
+        if (token_count >= 2) {
+          depth = strtol(tok[1], (char**)NULL, 10);
         }
+        bench(depth > 0 ? depth : 1);
         continue;
       }
 
@@ -895,7 +1236,8 @@ int main(int argc, char* argv[]) {
         if (token_count >= 2) {  // Takes a depth argument to test deeper
           depth = strtol(tok[1], (char**)NULL, 10);
         }
-        do_perft(gme, depth, 0);
+        bool divide = token_count >= 3 && strcmp(tok[2], "divide") == 0;
+        do_perft(gme, depth, divide);
         continue;
       }
 
@@ -903,6 +1245,7 @@ int main(int argc, char* argv[]) {
       continue;
     }
   }
+  UciWaitSearch();
   tt_free_hashtable();
 
   return 0;
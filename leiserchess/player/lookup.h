@@ -1,35 +0,0 @@
-// Copyright (c) 2018 MIT License by 6.172 Staff
-
-#ifndef LOOKUP_H
-#define LOOKUP_H
-
-#define OPEN_BOOK_DEPTH 6
-
-int lookup_sizes[OPEN_BOOK_DEPTH] = {
-  2, 120, 1200, 2000, 850, 1250
-};
-
-// Move histories are paired with their best moves in the lookup tables
-// IE: lookup_table_depth_n[] = {move_history1, best_move1, move_history2, best_move2, ...}
-char* lookup_table_depth_1[] = {"", "g4L"};
-char* lookup_table_depth_2[] = {"g4L", "b3L", "g4g5", "b3L", "d1d2", "b3L", "e2d2", "b3L", "d1R", "b3L", "d1c1", "b3L", "g3L", "b3L", "g3R", "b3L", "h0L", "b3L", "h0g0", "b3L", "e1L", "b3L", "e1U", "b3L", "e1R", "b3L", "e1f1", "b3L", "f2L", "b3L", "f2U", "b3L", "f2R", "b3L", "f2f1", "b3L", "g3U", "b3L", "g4U", "b3L", "g4R", "b3L", "d1U", "b3L", "f2g2", "b3L", "g3g2", "b3L", "f3g2", "b3L", "f2g1", "b3L", "f3R", "b3L", "d1L", "b3L", "g3f4", "b3L", "f3f4", "b3L", "e1e0", "b3L", "e1d0", "b3L", "h0g1", "b3L", "e1f0", "b3L", "d1c0", "b3L", "g3h4", "b3L", "d1d0", "b3L", "g4f5", "b3L", "h0h1", "e6R", "d1e0", "b3L", "g3h3", "b3L", "f3U", "b3L", "d1c2", "b3L", "f3L", "b3L", "f2e3", "b3L", "e2e3", "b3L", "e2d3", "b3L", "e2f1", "b3L", "g3h2", "b3L", "f3e3", "b3L", "g4f4", "b3L", "f3e4", "b3L", "e1d2", "b3L", "e2L", "b3L", "e2U", "b3L", "e2R", "b3L", "h0U", "b3L", "h0R", "b3L", "g4h5", "b3L", "g4h4", "b3L"};
-char* lookup_table_depth_3[] = {"g4Lb3L", "g4g5", "g4Ld6e7", "g4h4", "g4Ld6d7", "g4h5", "g4Ld6c7", "e2d3", "g4La7a6", "g4h5", "g4La7L", "g4h5", "g4Le6L", "g4h5", "g4La7b7", "g4h5", "g4La7b6", "g4h5", "g4Le6f6", "g3f4", "g4g5b3L", "g5L", "g4g5d6e7", "g5L", "g4g5d6d7", "g5L", "g4g5a7b6", "g5L", "g4g5e6f6", "g5L", "g4g5e6f5", "g5f5L", "g4g5a7b7", "g5L", "g4g5a7L", "g5L", "g4g5d6c7", "g5L", "g4g5b4R", "g5L", "d1d2b3L", "g4L", "d1d2b3b2", "g4L", "d1d2c4d4", "g4L", "d1d2b4R", "g4L", "d1d2e6R", "g4L", "d1d2e6f6", "g4L", "d1d2a7L", "g4L", "d1d2b4L", "g4L", "d1d2b3U", "g4L", "d1d2b3R", "g4L", "e2d2b3L", "g4L", "e2d2b3b2", "g4L", "e2d2c4d4", "g4L", "e2d2b4R", "g4L", "e2d2e6R", "g4L", "e2d2a7L", "g4L", "e2d2b4L", "g4L", "e2d2e6f6", "g4L", "e2d2b3U", "g4L", "e2d2b3R", "g4L", "d1Rb3L", "h0L", "d1Rb3b2", "h0L", "d1Rb4L", "g4L", "d1Rb4R", "g4L", "d1Ra7b7", "h0L", "d1Rb3U", "g4L", "d1Rb3R", "h0L", "d1Rb4U", "h0L", "d1Rb4b5", "g4L", "d1Rc5L", "g4g5", "d1c1b3L", "g4L", "d1c1e6e5", "h0L", "d1c1d5e5", "h0L", "d1c1e6f6", "g4L", "d1c1b4L", "g4L", "d1c1b4R", "g4L", "d1c1e6R", "g4L", "d1c1a7L", "g4L", "d1c1a7b7", "g4L", "d1c1a7b6", "g4L", "g3Lb3L", "g4L", "g3Lb3b2", "g4L", "g3Lb4L", "g4L", "g3Le6f6", "g4L", "g3Le6e5", "g4L", "g3La7b7", "g4L", "g3Lb4R", "g4L", "g3Ld5e5", "g4L", "g3Lc4R", "g4L", "g3Lb3U", "g4L", "g3Rb3L", "g4L", "g3Rb3b2", "f3R", "g3Re6R", "g4L", "g3Ra7L", "g4L", "g3Ra7b7", "g4L", "g3Re6e5", "g4g5", "g3Rb4R", "g4L", "g3Rd5e5", "g4L", "g3Rc4c3", "g4L", "g3Rb4L", "g4L", "h0Lb3L", "d1R", "h0Lb4L", "d1R", "h0Lb3b2", "d1R", "h0Lb4R", "d1R", "h0La7b7", "d1R", "h0Lc4R", "h0h1", "h0Lc4d3", "d1R", "h0Lb3U", "d1R", "h0Lb3R", "d1R", "h0Lb4U", "d1R", "h0g0b3L", "f2R", "h0g0b4R", "f3R", "h0g0e6R", "f3R", "h0g0a7b6", "g4L", "h0g0d5e4", "g4L", "h0g0a7b7", "g4L", "h0g0c4d4", "f3R", "h0g0b4c3", "g4L", "h0g0d5d4", "g4L", "h0g0e6e5", "g0L", "e1Lb3L", "g4L", "e1Lb3b2", "g4L", "e1Le6e5", "g4L", "e1Ld5e5", "g4L", "e1Lb4L", "g4L", "e1Lb4R", "g4L", "e1La7b7", "g4L", "e1Le6R", "g4L", "e1La7L", "g4L", "e1Lb3U", "g4L", "e1Ub3L", "g4L", "e1Ub3b2", "g4L", "e1Ud5e5", "g4L", "e1Ue6e5", "g4L", "e1Ue6f6", "g4L", "e1Ub4L", "g4L", "e1Ub4R", "g4L", "e1Ue6R", "g4L", "e1Ua7L", "g4L", "e1Ua7b7", "g4L", "e1Rb3L", "g4L", "e1Rb3b2", "g4L", "e1Rd5e5", "g4L", "e1Re6e5", "g4L", "e1Rb4L", "g4L", "e1Rb4R", "g4L", "e1Re6R", "g4L", "e1Re6f6", "g4L", "e1Ra7L", "g4L", "e1Ra7b7", "g4L", "e1f1b3L", "g4L", "e1f1b3b2", "g4L", "e1f1d5e5", "g4L", "e1f1e6e5", "g4L", "e1f1b4L", "g4L", "e1f1b4R", "g4L", "e1f1e6R", "g4L", "e1f1e6f6", "d1R", "e1f1a7L", "g4L", "e1f1a7b7", "g4L", "f2Lb3L", "g4L", "f2Lb3b2", "g4L", "f2Le6e5", "g4L", "f2Ld5e5", "g4L", "f2Lb4L", "g4L", "f2Lb4R", "g4L", "f2Le6R", "g4L", "f2Le6f6", "d1R", "f2La7L", "g4L", "f2La7b7", "g4L", "f2Ub3L", "g4L", "f2Ub3b2", "g4L", "f2Ue6e5", "g4L", "f2Ud5e5", "g4L", "f2Ub4L", "g4L", "f2Ub4R", "g4L", "f2Ue6R", "g4L", "f2Ue6f6", "g4L", "f2Ua7L", "g4L", "f2Ua7b7", "g4L", "f2Rb3L", "g4L", "f2Rb3b2", "g4L", "f2Rd5e5", "g4L", "f2Rb4L", "g4L", "f2Rb4R", "g4L", "f2Ra7b7", "g4L", "f2Ra7b6", "g4L", "f2Re6R", "g4L", "f2Re6f6", "d1R", "f2Ra7L", "g4L", "f2f1b3L", "g4L", "f2f1b3b2", "g4L", "f2f1e6e5", "g4L", "f2f1d5e5", "g4L", "f2f1b4L", "g4L", "f2f1b4R", "g4L", "f2f1e6R", "g4L", "f2f1e6f6", "g4L", "f2f1a7b7", "g4L", "f2f1a7b6", "g4L", "g3Ub3L", "g4L", "g3Ub3b2", "g4L", "g3Ud5e5", "g4L", "g3Ub4L", "g4L", "g3Ub4R", "g4g5", "g3Ue6R", "g4L", "g3Ue6f6", "g4L", "g3Ua7L", "g4L", "g3Ua7b7", "g4L", "g3Ub3U", "g4L", "g4Ub3L", "g4R", "g4Ub3b2", "g4R", "g4Ud5e5", "g4g5", "g4Ub4L", "g4h5", "g4Ub4R", "g4R", "g4Ue6R", "g4R", "g4Ue6f6", "g4R", "g4Ua7L", "g4R", "g4Ua7b7", "g4R", "g4Ub3U", "g4R", "g4Rb3L", "g4U", "g4Rb3b2", "g4U", "g4Re6f6", "g4U", "g4Re6e5", "g4U", "g4Rb4L", "g4U", "g4Rb4R", "g4U", "g4Rd5e5", "g4U", "g4Re6R", "g4U", "g4Ra7L", "g4U", "g4Ra7b7", "g4U", "d1Ub3L", "h0L", "d1Ua7b7", "g4L", "d1Ua7b6", "e1d2", "d1Ub3b2", "h0L", "d1Ub4L", "g4L", "d1Ub4R", "h0L", "d1Ue6e5", "g4L", "d1Ub3U", "g4L", "d1Ub3R", "g4L", "d1Ub4U", "g4L", "f2g2b3L", "g4L", "f2g2b3b2", "e1d0", "f2g2e6e5", "g4L", "f2g2d5e5", "g4L", "f2g2b4R", "g4L", "f2g2e6R", "g4L", "f2g2e6f6", "g4L", "f2g2a7b7", "g4L", "f2g2b4L", "g4L", "f2g2b3U", "g4L", "g3g2b3L", "g4L", "g3g2b3b2", "g4L", "g3g2e6e5", "g4L", "g3g2d5e5", "g4L", "g3g2b4L", "g4L", "g3g2b4R", "g4L", "g3g2e6R", "g4L", "g3g2e6f6", "g4L", "g3g2a7L", "g4L", "g3g2a7b7", "g4L", "f3g2b3L", "g4L", "f3g2b3b2", "g4L", "f3g2e6R", "g4L", "f3g2a7L", "g4L", "f3g2b4R", "g4L", "f3g2d5e5", "g4L", "f3g2e6e5", "g4L", "f3g2a7b7", "g4L", "f3g2b4L", "g4L", "f3g2b3U", "g4L", "f2g1b3L", "g4L", "f2g1b3b2", "g4L", "f2g1e6e5", "g4L", "f2g1d5e5", "g4L", "f2g1a7b7", "g4L", "f2g1b4L", "g4L", "f2g1b4R", "g4L", "f2g1e6R", "g4L", "f2g1e6f6", "g4L", "f2g1b3U", "g4L", "f3Rb3L", "g3R", "f3Rb3b2", "h0g1", "f3Ra7b7", "g4L", "f3Rd5e5", "h0g1", "f3Re6R", "g4L", "f3Re6e5", "g4L", "f3Rb4R", "h0g1", "f3Rc4c3", "g4L", "f3Rb4L", "h0g1", "f3Ra7L", "g4L", "d1Lb3L", "g4L", "d1La7b7", "g4L", "d1Lb3b2", "g4L", "d1Lb4L", "g4L", "d1Lb4R", "g4L", "d1Le6e5", "g4L", "d1Lb3U", "g4L", "d1Lb3R", "g4L", "d1Lb4U", "g4L", "d1Ld5e5", "g4L", "g3f4b3L", "g4L", "g3f4b3b2", "g4L", "g3f4e6R", "f4g5", "g3f4d5e5", "g4g5", "g3f4e6e5", "g4L", "g3f4a7L", "f3R", "g3f4b4L", "g4L", "g3f4b4R", "g4L", "g3f4b4c3", "g4L", "g3f4c5d4", "g4L", "f3f4b3L", "g4L", "f3f4b3b2", "g4L", "f3f4c5d4", "d1R", "f3f4b3U", "g4L", "f3f4b4U", "g4L", "f3f4d5e5", "g4L", "f3f4e6e5", "g4L", "f3f4a7a6", "g4L", "f3f4b4L", "g4L", "f3f4b4R", "g4L", "e1e0b3L", "g4L", "e1e0b3b2", "g4L", "e1e0e6e5", "g4L", "e1e0b4R", "g4L", "e1e0d5e5", "g4L", "e1e0e6R", "g4L", "e1e0e6f6", "g4L", "e1e0a7L", "g4L", "e1e0a7b7", "g4L", "e1e0b4L", "g4L", "e1d0b3L", "g4L", "e1d0b3b2", "g4L", "e1d0e6e5", "g4L", "e1d0a7b7", "g4L", "e1d0b4L", "g4L", "e1d0b4R", "g4L", "e1d0d5e5", "h0L", "e1d0e6R", "g4L", "e1d0e6f6", "g4L", "e1d0a7L", "g4L", "h0g1b3L", "g4L", "h0g1e6R", "f3R", "h0g1b4R", "g4L", "h0g1c4d4", "f3R", "h0g1a7L", "g4L", "h0g1a7b6", "g4L", "h0g1d5d4", "g4L", "h0g1b3b2", "g4L", "h0g1b4c3", "f3R", "h0g1a7b7", "g4L", "e1f0b3L", "g4L", "e1f0b3b2", "g4g5", "e1f0e6e5", "g4L", "e1f0a7b7", "g4L", "e1f0b4L", "g4L", "e1f0b4R", "g4L", "e1f0d5e5", "g4L", "e1f0e6R", "g4L", "e1f0e6f6", "g4L", "e1f0a7L", "g4L", "d1c0b3L", "f2R", "d1c0b3b2", "c0R", "d1c0b4L", "g4L", "d1c0b4R", "g4L", "d1c0a7b7", "g4g5", "d1c0e6e5", "c0R", "d1c0b3U", "g4L", "d1c0b3R", "g4L", "d1c0c4R", "g4L", "d1c0b4U", "c0R", "g3h4b3L", "h4g5", "g3h4b3b2", "g4R", "g3h4b4L", "h4h5", "g3h4b4R", "h4h5", "g3h4d5e5", "h4g5", "g3h4e6e5", "h4g5", "g3h4a7b7", "h4g5", "g3h4c4U", "g4L", "g3h4c4R", "h4g5", "g3h4e6R", "g4U", "d1d0b3L", "d0R", "d1d0b3b2", "d0R", "d1d0a7b7", "g4L", "d1d0b4L", "g4L", "d1d0b4R", "g4L", "d1d0b3U", "d0R", "d1d0b3R", "d0R", "d1d0b4U", "d0R", "d1d0c5L", "g4L", "d1d0c5U", "g4L", "g4f5e6f5g5", "h0L", "g4f5e6f5f4", "h0g1", "g4f5e6f5e4", "e6f6", "g4f5e6f5e5", "e6f7", "g4f5a7b6", "f5L", "g4f5e6f5R", "g3R", "g4f5b3L", "f5g6", "g4f5e6f7", "h0g0", "g4f5d6e7", "f5g6", "g4f5e6f5g4", "f3g4L", "h0h1b3L", "g4L", "h0h1b3b2", "d1R", "h0h1b4L", "g4L", "h0h1b4R", "g4L", "h0h1e6e5", "g4L", "h0h1a7b7", "g4L", "h0h1b3U", "g4g5", "h0h1b3R", "g4L", "h0h1b4U", "g4L", "h0h1d5e5", "h1L", "d1e0b3L", "e0R", "d1e0b3b2", "e0R", "d1e0b4R", "g4L", "d1e0a7b7", "g4L", "d1e0b4L", "g4L", "d1e0e6e5", "g4L", "d1e0d5e5", "g4L", "d1e0e6R", "g4L", "d1e0a7L", "g4L", "d1e0b3U", "g4L", "g3h3a7b7", "g4L", "g3h3b3L", "h0h1", "g3h3b3b2", "h3g3", "g3h3b4L", "f3R", "g3h3b4R", "g4L", "g3h3a7b6", "f3R", "g3h3d5e4", "g4L", "g3h3e6e5", "h0L", "g3h3c4d4", "h0L", "g3h3c4c3", "f3R", "f3Ub3L", "g3R", "f3Ub3b2", "g4L", "f3Ud5e5", "g4L", "f3Ue6R", "g4L", "f3Ue6e5", "g4L", "f3Ua7L", "g4L", "f3Ub4L", "g4L", "f3Ub4R", "g4L", "f3Ua7b7", "g4L", "f3Uc4R", "g4L", "d1c2b3c2b2", "g4L", "d1c2b3L", "g4L", "d1c2a7b7", "g4L", "d1c2e6R", "g4L", "d1c2a7L", "g4L", "d1c2b4R", "g4L", "d1c2b3c2b1", "g4L", "d1c2b3c2L", "g4L", "d1c2c5d4", "g4L", "d1c2b3c2U", "g4L", "f3Lb3L", "f3g2", "f3Lb3b2", "g4L", "f3Le6e5", "g4L", "f3Ld5e5", "g4L", "f3Le6R", "g4L", "f3La7b7", "g4L", "f3Lb4L", "g4L", "f3Lb4R", "g4L", "f3Lb3U", "g4L", "f3Lb3R", "g4L", "f2e3b3L", "e3e4", "f2e3b3b2", "g4L", "f2e3e6R", "g4L", "f2e3a7L", "g4L", "f2e3c4R", "g4L", "f2e3a7b7", "g4L", "f2e3b4R", "g4L", "f2e3e6f6", "g4L", "f2e3b4L", "g4L", "f2e3d5e5", "h0g0", "e2e3b3L", "g3R", "e2e3b3b2", "g4L", "e2e3d5e5", "h0L", "e2e3e6e5", "g4L", "e2e3e6R", "g4L", "e2e3a7L", "g4L", "e2e3a7b7", "g4L", "e2e3b4L", "g4L", "e2e3b4R", "g4L", "e2e3d6c7", "g4L", "e2d3b3L", "g3R", "e2d3e6R", "g4L", "e2d3a7L", "g4L", "e2d3c4d4", "g4L", "e2d3a7b7", "g4L", "e2d3b3b2", "g4L", "e2d3c4b5", "g4L", "e2d3b4L", "g4L", "e2d3d6e5", "h0L", "e2d3b3U", "g4L", "e2f1b3L", "g3R", "e2f1e6R", "g4L", "e2f1a7L", "g4L", "e2f1b3b2", "g3R", "e2f1a7b7", "g4L", "e2f1e6e5", "g4L", "e2f1b4R", "g4L", "e2f1d5e5", "g4L", "e2f1b4L", "g4L", "e2f1e6f6", "g4L", "g3h2b3L", "h2R", "g3h2a7b7", "g4L", "g3h2a7b6", "g4L", "g3h2b3b2", "h2R", "g3h2d5e4", "g4L", "g3h2c4R", "h2R", "g3h2b4L", "g4L", "g3h2b4R", "h2R", "g3h2c4U", "g4L", "g3h2c4d3", "g4L", "f3e3b3L", "e3L", "f3e3b3b2", "g4L", "f3e3d5e5", "g4L", "f3e3e6R", "g4L", "f3e3e6e5", "g4L", "f3e3a7L", "h0g0", "f3e3a7b7", "g4L", "f3e3c4R", "g4L", "f3e3b4L", "g4L", "f3e3b4R", "g4L", "g4f4a7b6", "f4L", "g4f4b3L", "f4L", "g4f4b3b2", "f4g5", "g4f4b4L", "f4g5", "g4f4d5e5", "f4g5", "g4f4c5d4", "f4g5", "g4f4a7b7", "f4g5", "g4f4c4d4", "f4g5", "g4f4e6e5", "f4g5", "g4f4b4R", "f4g5", "f3e4b3L", "e4f3", "f3e4b3b2", "e4f3", "f3e4b3U", "g4L", "f3e4b4U", "g4L", "f3e4d5e4e5", "g4L", "f3e4d5e4d4", "g4L", "f3e4d5e4L", "g4L", "f3e4d5e4f4", "g4L", "f3e4d5e5", "g4L", "f3e4b4L", "g4L", "e1d2b3L", "d2R", "e1d2a7b7", "g4L", "e1d2b3b2", "g4L", "e1d2e6R", "g4L", "e1d2a7L", "g4L", "e1d2a7b6", "f2R", "e1d2b4R", "g4L", "e1d2c4R", "g4L", "e1d2e6f6", "g4L", "e1d2d6c7", "g4L", "e2Lb3L", "e2d2", "e2Le6R", "g4L", "e2Lb3b2", "g4L", "e2La7b7", "g4g5", "e2Le6e5", "g4L", "e2Ld5e5", "h0L", "e2La7L", "g4L", "e2Lb4L", "g4L", "e2Lb4R", "d1R", "e2Le6f6", "h0L", "e2Ub3L", "d1c2", "e2Ue6R", "g4L", "e2Ub3b2", "g4L", "e2Ua7b7", "g4L", "e2Ua7L", "g4L", "e2Ue6e5", "g4L", "e2Uc4R", "g4L", "e2Ub4R", "g4L", "e2Ud5e5", "g4L", "e2Ub4L", "g4L", "e2Rb3L", "e2L", "e2Rb3b2", "h0g0", "e2Ra7b7", "g4L", "e2Re6R", "g4L", "e2Ra7L", "g4L", "e2Re6e5", "g4L", "e2Rd5e5", "g4L", "e2Rb4L", "g4L", "e2Re6f6", "h0g0", "e2Rb4R", "g4L", "h0Ub3b2", "h0R", "h0Ub3L", "h0R", "h0Uc4d3", "h0R", "h0Uc4c3", "d1R", "h0Ub4R", "h0U", "h0Ub4c3", "h0R", "h0Ua7b7", "h0U", "h0Ua7b6", "h0R", "h0Ub3c3", "h0R", "h0Ub3c2", "h0R", "h0Rb3L", "h0U", "h0Rb3b2", "h0U", "h0Rc4c3", "h0U", "h0Rb3c2", "h0U", "h0Rc4R", "g4L", "h0Rc4d3", "h0U", "h0Rb4R", "h0L", "h0Rb4c3", "h0U", "h0Ra7b7", "g4L", "h0Ra7b6", "d1R", "g4h5b3L", "h0g1", "g4h5a7b6", "g3R", "g4h5a7b7", "g3R", "g4h5b3b2", "h0g1", "g4h5b4L", "h0g1", "g4h5b4R", "g3R", "g4h5d5e4", "d1R", "g4h5c4d3", "g3R", "g4h5e6f5", "h0L", "g4h5e6e5", "d1R", "g4h4b3L", "h0g1", "g4h4a7b6", "g3R", "g4h4b3b2", "d1c2", "g4h4b4L", "g3R", "g4h4c4d3", "g3R", "g4h4e6e5", "d1R", "g4h4b4R", "g3R", "g4h4d5e4", "h0L", "g4h4e6f5", "h0L", "g4h4b3U", "d1R"};
-
-char* lookup_table_depth_4[] = {"g4Lb3Lg4g5", "b3b2", "g4Lb3Lg4h5", "d6c7", "g4Lb3Le1d0", "a7b6", "g4Lb3Le2d2", "b3b2", "g4Lb3Le1e0", "e6f5", "g4Lb3Ld1c2", "b4c3", "g4Lb3Lg4f5", "e6f5g4", "g4Lb3Le1f0", "a7b6", "g4Lb3Ld1d2", "b3b2", "g4Lb3Ld1c1", "b3a2", "g4Ld6e7f3e3", "b3L", "g4Ld6e7g4h5", "b3L", "g4Ld6e7g4g5", "b3L", "g4Ld6e7g4h4", "b3L", "g4Ld6e7f2e3", "b3L", "g4Ld6e7h0g1", "b3L", "g4Ld6e7e1d2", "b3L", "g4Ld6e7d1d2", "b3L", "g4Ld6e7e2d3", "b3L", "g4Ld6e7g3R", "b3L", "g4Ld6d7g4h5", "b3L", "g4Ld6d7g4g5", "b3L", "g4Ld6d7f3e4", "b3L", "g4Ld6d7f3e3", "b3L", "g4Ld6d7d1d2", "b3L", "g4Ld6d7f2e3", "b3L", "g4Ld6d7h0g1", "b3L", "g4Ld6d7e1R", "b3L", "g4Ld6d7e1d2", "b3L", "g4Ld6d7d1R", "b3L", "g4Ld6c7g4h5", "b3L", "g4Ld6c7g4g5", "b3L", "g4Ld6c7d1c1", "b3L", "g4Ld6c7f3e3", "b3L", "g4Ld6c7d1R", "b3L", "g4Ld6c7d1d2", "b3L", "g4Ld6c7f2e3", "b3L", "g4Ld6c7g4h4", "b3L", "g4Ld6c7h0g1", "b3L", "g4Ld6c7e1d2", "b3L", "g4La7a6g4h5", "b3L", "g4La7a6g4g5", "b3L", "g4La7a6e2d2", "a6L", "g4La7a6d1c1", "b3L", "g4La7a6g3f4", "b3L", "g4La7a6f3e3", "b3b2", "g4La7a6g4h4", "b3L", "g4La7a6e1L", "b3L", "g4La7a6e1U", "b3L", "g4La7a6e1R", "b3L", "g4La7Lg4h5", "a7a6", "g4La7Lg4g5", "e6f5", "g4La7Lf3R", "e6R", "g4La7Lf3e4", "a7a6", "g4La7Lg4h4", "e6R", "g4La7Le1L", "e6R", "g4La7Le1U", "e6R", "g4La7Le1R", "e6R", "g4La7Ld1c2", "e6R", "g4La7Lf2L", "e6R", "g4Le6Lg4h5", "a7b6", "g4Le6Lg4g5", "b3L", "g4Le6Le1L", "a7L", "g4Le6Lf3e4", "a7b6", "g4Le6Ld1c2", "b3L", "g4Le6Le2d2", "b3L", "g4Le6Lg3R", "b3L", "g4Le6Lf3R", "b3L", "g4Le6Lg4h4", "b3L", "g4Le6Ld1d2", "b3L", "g4La7b7g4g5", "c5R", "g4La7b7g4h5", "b3L", "g4La7b7e2d3", "b3L", "g4La7b7g4h4", "b3L", "g4La7b7d1d2", "b3L", "g4La7b7e2d2", "b3L", "g4La7b7g3f4", "b3L", "g4La7b7f2e3", "b7a6", "g4La7b7e1L", "c5R", "g4La7b7e1U", "b3L", "g4La7b6g4h5", "b3L", "g4La7b6f2e3", "c4R", "g4La7b6e2d3", "b3L", "g4La7b6g3f4", "b3L", "g4La7b6f2R", "b3L", "g4La7b6g4h4", "b3L", "g4La7b6h0g1", "b3L", "g4La7b6e1L", "b3L", "g4La7b6d1d2", "b3L", "g4La7b6d1c1", "b3L", "g4Le6f6g4g5", "a7a6", "g4Le6f6g4f5", "b3L", "g4Le6f6f2e3", "b3L", "g4Le6f6h0g0", "b3L", "g4Le6f6d1d2", "b3L", "g4Le6f6e2e3", "b3L", "g4Le6f6f3e3", "b3b2", "g4Le6f6g4h4", "b3L", "g4Le6f6e2d2", "b3L", "g4Le6f6h0g1", "b3L", "g4g5b3Lg5L", "d6e7", "g4g5b3Lg5g6", "d6e7", "g4g5b3Le2d2", "c4d3", "g4g5b3Lg3U", "b3a3", "g4g5b3Lg5U", "b3a2", "g4g5b3Le1e0", "a7b6", "g4g5b3Le1d0", "e6f5", "g4g5b3Le1f0", "e6f6", "g4g5b3Lg3R", "b3b2", "g4g5b3Lh0h1", "a7b6", "g4g5d6e7g5L", "b3L", "g4g5d6e7g3R", "b3L", "g4g5d6e7f3e3", "b3L", "g4g5d6e7d1R", "b3L", "g4g5d6e7g5g6", "b3L", "g4g5d6e7d1d2", "b3L", "g4g5d6e7g3g4", "b3L", "g4g5d6e7g3f4", "b3L", "g4g5d6e7e1L", "b3L", "g4g5d6e7e1U", "b3L", "g4g5d6Rg5L", "b3L", "g4g5d6Rf3e3", "b3L", "g4g5d6Rg3R", "b3L", "g4g5d6Rg5g6", "d6e7", "g4g5d6Re1d2", "b3L", "g4g5d6Rd1R", "b3L", "g4g5d6Rd1d2", "b3L", "g4g5d6Re1L", "b3L", "g4g5d6Re1U", "b3L", "g4g5d6Re1R", "b3L", "g4g5d6d7g5L", "b3L", "g4g5d6d7g3R", "b3L", "g4g5d6d7d1d2", "b3L", "g4g5d6d7f3R", "b3L", "g4g5d6d7f3e3", "b3L", "g4g5d6d7e1L", "b3L", "g4g5d6d7e1U", "b3L", "g4g5d6d7e1R", "b3L", "g4g5d6d7e1f1", "b3L", "g4g5d6d7d1c1", "b3L", "g4g5a7b7g5L", "d6e7", "g4g5a7b7g3R", "b3L", "g4g5a7b7g3f4", "d6e7", "g4g5a7b7g3g4", "b3L", "g4g5a7b7f3R", "c5R", "g4g5a7b7f3e3", "b3L", "g4g5a7b7g5g6", "e6f5", "g4g5a7b7e2e3", "b3L", "g4g5a7b7e2d3", "b3L", "g4g5a7b7g5U", "b3L", "g4g5c5b6g5L", "b3L", "g4g5c5b6f3e3", "b3L", "g4g5c5b6g5g6", "d6e7", "g4g5c5b6e1d2", "b3L", "g4g5c5b6g3R", "b3L", "g4g5c5b6d1R", "b3L", "g4g5c5b6d1d2", "b3L", "g4g5c5b6g3g4", "b3L", "g4g5c5b6e1L", "b3L", "g4g5c5b6e1U", "b3L", "g4g5e6f6g5L", "a7L", "g4g5e6f6g5f6L", "a7a6", "g4g5e6f6g3R", "a7L", "g4g5e6f6g3g4", "a7a6", "g4g5e6f6f3R", "b3L", "g4g5e6f6g5g4", "b3L", "g4g5e6f6g5f6g6", "a7b6", "g4g5e6f6h0g0", "b3L", "g4g5e6f6d1R", "b3L", "g4g5e6f6h0L", "b3L", "g4g5e6f5g5f5L", "a7b6", "g4g5e6f5g5L", "a7b6", "g4g5e6f5g5f5g4", "b3L", "g4g5e6f5d1R", "b3L", "g4g5e6f5g5f5g6", "a7b6", "g4g5e6f5h0L", "f5g5R", "g4g5e6f5g3g4", "b3L", "g4g5e6f5h0g0", "b3L", "g4g5e6f5f3R", "b3L", "g4g5e6f5f2e3", "b3L", "g4g5a7b6g5L", "b3L", "g4g5a7b6d1R", "b3L", "g4g5a7b6g3f4", "b3L", "g4g5a7b6g3g4", "c4R", "g4g5a7b6f3R", "c4R", "g4g5a7b6f3e3", "e6f5", "g4g5a7b6e2e3", "b3L", "g4g5a7b6g3R", "b3L", "g4g5a7b6d1c1", "b3L", "g4g5a7b6e1L", "c4R", "g4g5d6c7g5L", "b3L", "g4g5d6c7g3R", "b3L", "g4g5d6c7e1d2", "b3L", "g4g5d6c7d1d2", "b3b2", "g4g5d6c7f3e3", "a7L", "g4g5d6c7f2R", "b3L", "g4g5d6c7e2d2", "e6R", "g4g5d6c7g3g4", "b3L", "g4g5d6c7g5U", "b3b2", "g4g5d6c7g5g6", "b3L", "d1d2b3Lg4L", "b3b2", "d1d2b3Lh0h1", "b3a2", "d1d2b3Lh0L", "e6f5", "d1d2b3Le1d1", "b3a2", "d1d2b3Ld2L", "b3a2", "d1d2b3Lh0g1", "b3a2", "d1d2b3Lf3e3", "b3a2", "d1d2b3Le1d0", "b3a2", "d1d2b3Ld2c1", "b3c2", "d1d2b3Lf2R", "b3a2", "d1d2b3b2e1d1", "b2L", "d1d2b3b2g4L", "b2L", "d1d2b3b2h0g1", "b2L", "d1d2b3b2d2c1", "b2c1L", "d1d2b3b2d2c3", "b2c3L", "d1d2b3b2d2c2", "b2c2L", "d1d2b3b2h0L", "b2L", "d1d2b3b2h0h1", "b2L", "d1d2b3b2e1d0", "b2L", "d1d2b3b2d2L", "b2L", "d1d2c4d4g4L", "b3L", "d1d2c4d4g4g5", "b3L", "d1d2c4d4h0g0", "b3b2", "d1d2c4d4e2d3", "b3L", "d1d2c4d4e1d1", "b3L", "d1d2c4d4g3L", "b3L", "d1d2c4d4g3R", "b3L", "d1d2c4d4e2d1", "b3L", "d1d2c4d4e1L", "b3L", "d1d2c4d4f2L", "b3L", "d1d2b4Rg4L", "b3L", "d1d2b4Rg4g5", "b3L", "d1d2b4Rg3R", "b3b2", "d1d2b4Rh0g0", "b3L", "d1d2b4Rd2d3", "b3L", "d1d2b4Re2d3", "b3L", "d1d2b4Rg3L", "b3b2", "d1d2b4Rf3e4", "b3L", "d1d2b4Re2e3", "b3L", "d1d2b4Rf3f4", "b3L", "d1d2e6Rg4L", "a7L", "d1d2e6Rd2d1", "b3b2", "d1d2e6Rd2c1", "a7L", "d1d2e6Rf3e4", "b3L", "d1d2e6Rh0g0", "b3L", "d1d2e6Rf3e3", "b3L", "d1d2e6Rh0g1", "b3L", "d1d2e6Rg4f4", "b3L", "d1d2e6Re2R", "b3L", "d1d2e6Rg3R", "a7L", "d1d2d6e5g4L", "b3L", "d1d2d6e5g4g5", "b3L", "d1d2d6e5d2c3", "b3L", "d1d2d6e5d2c1", "b3L", "d1d2d6e5h0g0", "b3L", "d1d2d6e5f3R", "b3L", "d1d2d6e5h0g1", "b3L", "d1d2d6e5d2d1", "b3L", "d1d2d6e5e2e3", "b3L", "d1d2d6e5f3e3", "b3L", "d1d2a7Lg4L", "e6R", "d1d2a7Ld2R", "e6R", "d1d2a7Ld2d1", "e6R", "d1d2a7Ld2c1", "e6R", "d1d2a7Ld2U", "e6R", "d1d2a7Lf3e4", "e6R", "d1d2a7Lh0g0", "e6R", "d1d2a7Lf3e3", "e6R", "d1d2a7Lh0g1", "e6R", "d1d2a7Le2R", "e6R", "d1d2b4Lg4L", "b3L", "d1d2b4Lg4g5", "b3L", "d1d2b4Lg3L", "b3L", "d1d2b4Lg3R", "b3L", "d1d2b4Le2d3", "b3L", "d1d2b4Le1L", "b3L", "d1d2b4Le1U", "e6R", "d1d2b4Le1R", "b3L", "d1d2b4Le1d1", "e6R", "d1d2b4Ld2d3", "b3L", "d1d2b3Ug4L", "b3R", "d1d2b3Ug4g5", "b3R", "d1d2b3Ue2d3", "b3R", "d1d2b3Ug3L", "b4R", "d1d2b3Ug3R", "b3R", "d1d2b3Ue1L", "b4R", "d1d2b3Ue1U", "e6R", "d1d2b3Ue1d1", "e6R", "d1d2b3Uf2L", "b3R", "d1d2b3Uf2U", "a7L", "d1d2b3Rg4L", "b3U", "d1d2b3Rg3L", "b3U", "d1d2b3Rg4g5", "b3U", "d1d2b3Re2d3", "b3U", "d1d2b3Rd2c1", "e6f6", "d1d2b3Re2e3", "b3U", "d1d2b3Rf3e3", "b3U", "d1d2b3Re1L", "b3U", "d1d2b3Re1U", "b3U", "d1d2b3Re1d1", "a7L", "e2d2b3Lg4L", "b3b2", "e2d2b3Lg4g5", "c4d3", "e2d2b3Le1d0", "b3a2", "e2d2b3Le1f0", "b3a2", "e2d2b3Le1e0", "b3a2", "e2d2b3Lh0h1", "b3a2", "e2d2b3Ld2L", "b4c3", "e2d2b3Lh0g1", "b3a2", "e2d2b3Ld1L", "b3a2", "e2d2b3Ld1e2", "b3a2", "e2d2b3b2e1d0", "b2L", "e2d2b3b2g4L", "b2L", "e2d2b3b2e1e0", "b2L", "e2d2b3b2d2L", "b2L", "e2d2b3b2h0g1", "b2L", "e2d2b3b2d1c1", "b2c1L", "e2d2b3b2e1f0", "b2L", "e2d2b3b2d1c2", "b2c2L", "e2d2b3b2d2c1", "b2L", "e2d2b3b2d2c3", "b2c3L", "e2d2c4d4g4L", "b3L", "e2d2c4d4h0g0", "b3L", "e2d2c4d4g3R", "b3L", "e2d2c4d4g4g5", "b3L", "e2d2c4d4e1e2", "b3L", "e2d2c4d4g3L", "b3L", "e2d2c4d4e1L", "b3L", "e2d2c4d4e1U", "b3L", "e2d2c4d4e1R", "b3L", "e2d2c4d4e1f1", "b3L", "e2d2b4Rg4L", "c4R", "e2d2b4Rg4g5", "c4R", "e2d2b4Rd1R", "b3L", "e2d2b4Rh0L", "b3L", "e2d2b4Rh0g0", "b3L", "e2d2b4Rd1c1", "e6R", "e2d2b4Rg3R", "e6R", "e2d2b4Rg3L", "c4R", "e2d2b4Rf3e4", "c4R", "e2d2b4Rh0h1", "c4R", "e2d2e6Rd2e2", "b3L", "e2d2e6Rg4L", "a7L", "e2d2e6Re1f1", "b3L", "e2d2e6Rd1R", "a7L", "e2d2e6Rh0L", "a7L", "e2d2e6Rf3e4", "b3b2", "e2d2e6Rf3e3", "a7L", "e2d2e6Rh0g0", "b3L", "e2d2e6Re1d0", "a7L", "e2d2e6Rh0g1", "b3L", "e2d2a7Ld2e2", "e6R", "e2d2a7Lg4L", "e6R", "e2d2a7Lf3e3", "e6R", "e2d2a7Lh0g0", "e6R", "e2d2a7Le1f1", "e6R", "e2d2a7Ld1R", "e6R", "e2d2a7Lh0L", "e6R", "e2d2a7Lf3e4", "e6R", "e2d2a7Le1d0", "e6R", "e2d2a7Lh0g1", "e6R", "e2d2b4Lg3L", "e6R", "e2d2b4Lg4L", "b3L", "e2d2b4Lg4g5", "b3L", "e2d2b4Lh0g0", "b3L", "e2d2b4Ld1c1", "e6R", "e2d2b4Lg3R", "e6R", "e2d2b4Le1e2", "a7L", "e2d2b4Ld1e2", "b3L", "e2d2b4Lf3R", "b3L", "e2d2b4Le1U", "b3L", "e2d2b3Ug4L", "b3R", "e2d2b3Ug4g5", "b3R", "e2d2b3Ug3R", "e6R", "e2d2b3Ue1e2", "a7L", "e2d2b3Ud1e2", "e6R", "e2d2b3Ud1c1", "e6R", "e2d2b3Ug3L", "b3b2", "e2d2b3Uh0g0", "b3a2", "e2d2b3Ue1U", "e6R", "e2d2b3Ue1R", "e6R", "e2d2b3Rg4L", "b3U", "e2d2b3Rd1c1", "e6R", "e2d2b3Rg3L", "b3U", "e2d2b3Rg4g5", "b3U", "e2d2b3Rg3R", "b3U", "e2d2b3Re1e2", "a7L", "e2d2b3Rd1e2", "e6R", "e2d2b3Rf2e2", "b3U", "e2d2b3Rf3e3", "b3U", "e2d2b3Rh0g0", "b3U", "e2d2b4Ug4L", "b3L", "e2d2b4Ug3L", "e6R", "e2d2b4Ug3R", "e6R", "e2d2b4Uf3e3", "b3L", "e2d2b4Ue1e2", "b3L", "e2d2b4Ud1c1", "e6R", "e2d2b4Ug4g5", "b3L", "e2d2b4Ue1U", "b3L", "e2d2b4Ue1R", "b3L", "e2d2b4Ud1U", "b3L", "d1Rb3Lh0L", "b3a3", "d1Rb3Ld1e0", "b4c3", "d1Rb3Lh0h1", "b4c3", "d1Rb3Lh0g1", "c4R", "d1Rb3Le1e0", "b4c3", "d1Rb3Le1d0", "b4c3", "d1Rb3Le1f0", "c4R", "d1Rb3Ld1U", "b3a2", "d1Rb3Ld1c1", "b3a2", "d1Rb3Ld1L", "b3a2", "d1Rb3b2h0L", "b2L", "d1Rb3b2d1d0", "b2L", "d1Rb3b2d1c0", "b2L", "d1Rb3b2e1d0", "b2L", "d1Rb3b2d1e0", "b2L", "d1Rb3b2h0h1", "b2L", "d1Rb3b2e1e0", "b2L", "d1Rb3b2e1f0", "b2L", "d1Rb3b2h0g1", "b2L", "d1Rb3b2e1R", "b2L", "d1Rb4Lh0L", "b3L", "d1Rb4Ld1c1", "b3L", "d1Rb4Ld1d0", "b3L", "d1Rb4Lg4L", "b3L", "d1Rb4Lg4g5", "b3L", "d1Rb4Le1R", "b3L", "d1Rb4Lh0h1", "b3L", "d1Rb4Lh0g0", "b3L", "d1Rb4Le1L", "b3L", "d1Rb4Le2d2", "b3L", "d1Rb4Rh0L", "b3L", "d1Rb4Rg4L", "b3L", "d1Rb4Rg4g5", "b3L", "d1Rb4Re1R", "b3L", "d1Rb4Rd1c1", "b3L", "d1Rb4Re1L", "b3L", "d1Rb4Re2L", "b3L", "d1Rb4Re2d2", "b3L", "d1Rb4Rh0g0", "b3L", "d1Rb4Re1U", "b3L", "d1Ra7b7h0L", "b3L", "d1Ra7b7e1R", "c5R", "d1Ra7b7d1c1", "b3L", "d1Ra7b7e1L", "c4R", "d1Ra7b7g4g5", "b3L", "d1Ra7b7e1U", "b3L", "d1Ra7b7e1f1", "c4R", "d1Ra7b7f2L", "c4R", "d1Ra7b7f2U", "c4R", "d1Ra7b7f2R", "c4R", "d1Rb3Ud1c0", "b3R", "d1Rb3Uh0L", "b3R", "d1Rb3Ug4L", "b3R", "d1Rb3Uh0h1", "b3R", "d1Rb3Ud1c1", "b3R", "d1Rb3Ue1R", "b3R", "d1Rb3Ug4g5", "b3R", "d1Rb3Ue1L", "b3R", "d1Rb3Ud1d0", "b4a3", "d1Rb3Ue1U", "b3R", "d1Rb3Rh0L", "b3U", "d1Rb3Rd1c1", "b3U", "d1Rb3Rh0h1", "b4R", "d1Rb3Re1R", "b3U", "d1Rb3Rg4L", "b3U", "d1Rb3Rg4g5", "b3b2", "d1Rb3Rd1d0", "b4a3", "d1Rb3Re1L", "b3U", "d1Rb3Re2L", "a7b7", "d1Rb3Rg3L", "b3U", "d1Rb4Uh0L", "b3L", "d1Rb4Ug4L", "b3L", "d1Rb4Ud1c1", "b4U", "d1Rb4Ug4g5", "b3L", "d1Rb4Ue1R", "b3L", "d1Rb4Ue2L", "b3L", "d1Rb4Ue2d2", "b3L", "d1Rb4Ue1L", "b3L", "d1Rb4Ud1d0", "b3L", "d1Rb4Uh0h1", "b3L", "d1Rb4b5h0L", "b3L", "d1Rb4b5g4L", "b3L", "d1Rb4b5g4g5", "b3L", "d1Rb4b5e1R", "b3L", "d1Rb4b5d1c1", "b3L", "d1Rb4b5e2L", "b3L", "d1Rb4b5e1L", "b3L", "d1Rb4b5d1d0", "b3L", "d1Rb4b5d1c0", "b3L", "d1Rb4b5e2d2", "b3L", "d1Rc5Lh0L", "b3L", "d1Rc5Lg4L", "b3L", "d1Rc5Lg4g5", "b3L", "d1Rc5Ld1c1", "b3L", "d1Rc5Le1R", "b3L", "d1Rc5Le1L", "b3L", "d1Rc5Ld1d0", "b3L", "d1Rc5Le2d2", "b3L", "d1Rc5Lh0h1", "b3L", "d1Rc5Lh0g0", "b3L", "d1c1b3Lg4L", "b3a2", "d1c1b3Lh0L", "b3a3", "d1c1b3Lh0g1", "c4R", "d1c1b3Lg3R", "b3c2", "d1c1b3Lh0h1", "b4c3", "d1c1b3Le1d0", "c4R", "d1c1b3Le1L", "b3c2", "d1c1b3Lg3U", "b3a2", "d1c1b3Lf2f1", "b3c2", "d1c1b3Lg4g5", "b3c2", "d1c1e6e5h0L", "a7b7", "d1c1e6e5c1R", "e5e6", "d1c1e6e5g4L", "b3L", "d1c1e6e5g4g5", "b3L", "d1c1e6e5f3e3", "b3L", "d1c1e6e5e1L", "b3L", "d1c1e6e5g4U", "b3L", "d1c1e6e5g4R", "b3L", "d1c1e6e5g3L", "b3L", "d1c1e6e5g3R", "b3L", "d1c1b4Lg4L", "b3L", "d1c1b4Lc1R", "b3L", "d1c1b4Lg4g5", "b3L", "d1c1b4Lh0L", "b3L", "d1c1b4Lh0g0", "b3L", "d1c1b4Le2d2", "e6R", "d1c1b4Lg3L", "b3L", "d1c1b4Lg3R", "b3L", "d1c1b4Le1L", "b3L", "d1c1b4Le1U", "b3L", "d1c1b4Rg4L", "c4R", "d1c1b4Rc1R", "b3L", "d1c1b4Rh0L", "b3L", "d1c1b4Re2d2", "a7L", "d1c1b4Rg4g5", "c4R", "d1c1b4Rh0g0", "b3L", "d1c1b4Rc1d2", "a7L", "d1c1b4Rh0g1", "c4R", "d1c1b4Rg3f4", "b3L", "d1c1b4Re1d1", "c4R", "d1c1e6f6c1R", "b3L", "d1c1e6f6g4L", "b3L", "d1c1e6f6h0L", "b3L", "d1c1e6f6h0g0", "b3c2", "d1c1e6f6e2d2", "a7L", "d1c1e6f6c1d2", "f6R", "d1c1e6f6g3L", "b3L", "d1c1e6f6g3R", "b3L", "d1c1e6f6e1L", "b3L", "d1c1e6f6e1U", "b3L", "d1c1a7b7g4L", "b3L", "d1c1a7b7c1R", "b3L", "d1c1a7b7e2d3", "b3L", "d1c1a7b7h0g1", "b3L", "d1c1a7b7h0g0", "b3L", "d1c1a7b7g4g5", "d5R", "d1c1a7b7e1d2", "c4R", "d1c1a7b7c1d2", "b3L", "d1c1a7b7g3f4", "b3c2", "d1c1a7b7h0L", "b3L", "d1c1b3Ug4L", "b4R", "d1c1b3Uc1R", "b3R", "d1c1b3Ue2d2", "e6R", "d1c1b3Ug4g5", "b3R", "d1c1b3Uh0L", "b3R", "d1c1b3Uc1d2", "e6R", "d1c1b3Ug3L", "b4a3", "d1c1b3Ug3R", "b3R", "d1c1b3Uh0g0", "b3R", "d1c1b3Ue1L", "b3c2", "d1c1b3Rg4L", "b3U", "d1c1b3Rc1R", "b3U", "d1c1b3Rh0L", "b3U", "d1c1b3Re2d2", "e6R", "d1c1b3Rg4g5", "b3U", "d1c1b3Rh0g0", "b3c2", "d1c1b3Rc1d2", "e6R", "d1c1b3Re1L", "b3U", "d1c1b3Rg3R", "b3U", "d1c1b3Rg3L", "b3U", "d1c1c5Lg4L", "b3L", "d1c1c5Lc1R", "b3L", "d1c1c5Le2d2", "e6R", "d1c1c5Lg4g5", "b3L", "d1c1c5Lh0L", "b3L", "d1c1c5Lh0g0", "b3L", "d1c1c5Lc1d2", "b3L", "d1c1c5Lg3R", "b3L", "d1c1c5Lg3L", "b3L", "d1c1c5Le1L", "b3L", "d1c1c5Ug4L", "a7L", "d1c1c5Uc1R", "b3L", "d1c1c5Ue2d2", "e6R", "d1c1c5Ug4g5", "b3L", "d1c1c5Uh0L", "b3L", "d1c1c5Uh0g0", "b3L", "d1c1c5Uc1d2", "b3L", "d1c1c5Ug3R", "b3L", "d1c1c5Ug3L", "b3L", "d1c1c5Ue1L", "b3L", "g3Lb3Le1e0", "e6f5", "g3Lb3Le1d0", "e6f5", "g3Lb3Lg4L", "b3a2", "g3Lb3Le1f0", "e6f5", "g3Lb3Lh0h1", "b3a2", "g3Lb3Lh0L", "c4R", "g3Lb3Le1L", "b3a2", "g3Lb3Ld1c1", "b3c2", "g3Lb3Le1R", "b3a2", "g3Lb3Lf2L", "b3a2", "g3Lb3b2e1d0", "b2L", "g3Lb3b2g4L", "b2L", "g3Lb3b2e1e0", "b2L", "g3Lb3b2d1c1", "b2L", "g3Lb3b2e1f0", "b2L", "g3Lb3b2d1c2", "b2c2L", "g3Lb3b2h0h1", "b2L", "g3Lb3b2h0L", "b2L", "g3Lb3b2g3U", "b2L", "g3Lb3b2e1L", "b2L", "g3Lb4Lg4L", "b3L", "g3Lb4Le2d2", "e6R", "g3Lb4Ld1c1", "b3L", "g3Lb4Lg4g5", "b3L", "g3Lb4Le1L", "b3L", "g3Lb4Le1U", "b3L", "g3Lb4Le1R", "b3L", "g3Lb4Le1f1", "b3L", "g3Lb4Lf2L", "b3L", "g3Lb4Lf2U", "b3L", "g3Le6f6d1d2", "a7L", "g3Le6f6e2d2", "a7L", "g3Le6f6g4L", "b3L", "g3Le6f6d1c1", "b3L", "g3Le6f6e1L", "b3L", "g3Le6f6e1U", "b3L", "g3Le6f6e1R", "b3L", "g3Le6f6e1f1", "b3L", "g3Le6f6f2L", "b3L", "g3Le6f6f2U", "b3L", "g3Le6e5f3e3", "b3L", "g3Le6e5g4L", "b3L", "g3Le6e5d1R", "b3L", "g3Le6e5d1c1", "b3L", "g3Le6e5g4g5", "e5f4", "g3Le6e5e1d2", "b3L", "g3Le6e5g3U", "b3L", "g3Le6e5h0L", "b3L", "g3Le6e5e1L", "b3L", "g3Le6e5e1U", "b3L", "g3La7b7g4L", "c5R", "g3La7b7d1R", "c4R", "g3La7b7g3U", "c4R", "g3La7b7f3e3", "c4R", "g3La7b7e1d2", "c4R", "g3La7b7d1d2", "c4R", "g3La7b7e2e3", "b3L", "g3La7b7e2d3", "b3L", "g3La7b7e1L", "c4R", "g3La7b7e1U", "c4R", "g3Lb4Rg4L", "b3L", "g3Lb4Rg4g5", "c4R", "g3Lb4Rd1R", "b3L", "g3Lb4Rh0L", "b3L", "g3Lb4Re2d2", "c4R", "g3Lb4Rg3U", "c4R", "g3Lb4Re1L", "b3L", "g3Lb4Re1U", "b3L", "g3Lb4Re1R", "b4c3", "g3Lb4Re1f1", "b3L", "g3Ld5e5f3e3", "b3L", "g3Ld5e5g4L", "b3L", "g3Ld5e5d1R", "b3L", "g3Ld5e5e1d2", "b3L", "g3Ld5e5g3U", "b3L", "g3Ld5e5h0L", "b3L", "g3Ld5e5e1L", "b3L", "g3Ld5e5e1U", "b3L", "g3Ld5e5e1R", "b3L", "g3Ld5e5e1f1", "b3L", "g3Lc4Rg4L", "a7b6", "g3Lc4Rg4g5", "a7b6", "g3Lc4Rd1R", "b3L", "g3Lc4Rd1d2", "a7b6", "g3Lc4Re2d2", "a7b6", "g3Lc4Re1U", "b3L", "g3Lc4Rg3U", "a7b7", "g3Lc4Re1L", "a7b6", "g3Lc4Re1R", "a7b6", "g3Lc4Re1f1", "a7b6", "g3Lc4b5d1R", "b3L", "g3Lc4b5g4L", "b3L", "g3Lc4b5g4g5", "b3L", "g3Lc4b5d1d2", "b3L", "g3Lc4b5h0L", "b3L", "g3Lc4b5e2d2", "b3L", "g3Lc4b5g3U", "b3L", "g3Lc4b5e1L", "b3L", "g3Lc4b5e1U", "b3L", "g3Lc4b5e1R", "b3L", "g3Rb3Lg4L", "b3b2", "g3Rb3Lg4g5", "b3a2", "g3Rb3Le1d0", "b3a2", "g3Rb3Le1f0", "b3a3", "g3Rb3Le1e0", "b3a2", "g3Rb3Ld1c0", "b3b2", "g3Rb3Le2f1", "b3a3", "g3Rb3Lh0h1", "b3b2", "g3Rb3Ld1d0", "b3a2", "g3Rb3Lg3h2", "b3a3", "g3Rb3b2e1d0", "b2L", "g3Rb3b2g4L", "b2L", "g3Rb3b2e1e0", "b2L", "g3Rb3b2d1c1", "b2L", "g3Rb3b2h0h1", "b2L", "g3Rb3b2d1c2", "b2c2L", "g3Rb3b2f3R", "b2L", "g3Rb3b2e1f0", "b2L", "g3Rb3b2g4g5", "b2L", "g3Rb3b2g4R", "b2L", "g3Re6Rg4g5", "a7L", "g3Re6Rg4L", "a7L", "g3Re6Rg4U", "b3L", "g3Re6Rg3U", "b3b2", "g3Re6Rg3f4", "a7L", "g3Re6Re1L", "b3L", "g3Re6Re1U", "b3L", "g3Re6Re1R", "b3b2", "g3Re6Rg3g2", "b3L", "g3Re6Rg4R", "b3L", "g3Ra7Lg4g5", "e6R", "g3Ra7Lg4L", "e6R", "g3Ra7Lg4U", "e6R", "g3Ra7Lf3f4", "a7R", "g3Ra7Lf2L", "e6R", "g3Ra7Lg3U", "e6R", "g3Ra7Lg3f4", "e6R", "g3Ra7Le1L", "e6R", "g3Ra7Le1U", "e6R", "g3Ra7Le1R", "e6R", "g3Ra7b7g4U", "b3L", "g3Ra7b7g4g5", "b3L", "g3Ra7b7g4R", "c4R", "g3Ra7b7g4L", "b3L", "g3Ra7b7f3R", "c4R", "g3Ra7b7e2d3", "b3L", "g3Ra7b7d1R", "c4R", "g3Ra7b7d1d2", "c4R", "g3Ra7b7e2d2", "c4R", "g3Ra7b7f3e3", "c4R", "g3Re6e5g4g5", "d6e7", "g3Re6e5g4R", "b3L", "g3Re6e5g4U", "b3L", "g3Re6e5f3R", "b3L", "g3Re6e5g4L", "b3L", "g3Re6e5f3e3", "b3L", "g3Re6e5d1c1", "b3L", "g3Re6e5e2e3", "b3L", "g3Re6e5e1d2", "b3L", "g3Re6e5d1R", "a7b7", "g3Rb4Rf3R", "b3L", "g3Rb4Rg4g5", "b3L", "g3Rb4Rg4R", "b3L", "g3Rb4Rg4L", "b3L", "g3Rb4Rg4U", "b4c3", "g3Rb4Rd1d2", "b3b2", "g3Rb4Re2d3", "b3L", "g3Rb4Rd1R", "b3L", "g3Rb4Rg3f4", "b3L", "g3Rb4Re2d2", "b3L", "g3Rd5e5f3R", "b3L", "g3Rd5e5f3e3", "b3L", "g3Rd5e5g4L", "b3L", "g3Rd5e5g4U", "b3L", "g3Rd5e5g4R", "b3L", "g3Rd5e5g4g5", "b3L", "g3Rd5e5e2e3", "b3L", "g3Rd5e5d1R", "b3L", "g3Rd5e5f3U", "b3L", "g3Rd5e5e1L", "b3L", "g3Rc4c3g4L", "b3L", "g3Rc4c3g4g5", "b3L", "g3Rc4c3f2e3", "d5e4", "g3Rc4c3g4R", "b3L", "g3Rc4c3e2e3", "e6R", "g3Rc4c3f3R", "b3L", "g3Rc4c3e2d2", "b3L", "g3Rc4c3g4U", "b3L", "g3Rc4c3d1d2", "b3L", "g3Rc4c3e2f1", "c3c4", "g3Rb4Lg4U", "b3L", "g3Rb4Lg4R", "b3L", "g3Rb4Lg4g5", "b3L", "g3Rb4Lf3R", "b3L", "g3Rb4Lg4L", "b3L", "g3Rb4Ld1c1", "b3L", "g3Rb4Le2d3", "b3L", "g3Rb4Le2d2", "e6R", "g3Rb4Lg3f4", "b3L", "g3Rb4Lg3U", "b3L", "h0Lb3Ld1R", "b3a2", "h0Lb3Lh0h1", "c4R", "h0Lb3Le1d0", "b3a3", "h0Lb3Ld1U", "b3a2", "h0Lb3Ld1c1", "b3a3", "h0Lb3Ld1d2", "e6f5", "h0Lb3Ld1c2", "a7b7", "h0Lb3Ld1L", "b3a2", "h0Lb3Le1f0", "b4c3", "h0Lb3Le1e0", "b3a3", "h0Lb3b2d1R", "b2L", "h0Lb3b2e1d0", "b2L", "h0Lb3b2d1U", "b2L", "h0Lb3b2h0h1", "b4b3", "h0Lb3b2e1e0", "b2L", "h0Lb3b2e2e3", "b4b3", "h0Lb3b2d1c1", "b2L", "h0Lb3b2d1c2", "b2c2L", "h0Lb3b2h0g1", "b2L", "h0Lb3b2d1d2", "b2L", "h0Lb4Ld1R", "b3L", "h0Lb4Ld1c1", "b3L", "h0Lb4Lh0h1", "b3L", "h0Lb4Le1R", "b3L", "h0Lb4Le1L", "b3L", "h0Lb4Le2d2", "b3L", "h0Lb4Lg4g5", "b3L", "h0Lb4Lg3f4", "b3L", "h0Lb4Le1U", "b3L", "h0Lb4Le1f1", "b3L", "h0Lb4Rd1R", "b3L", "h0Lb4Re1L", "b3L", "h0Lb4Re2L", "b3L", "h0Lb4Rd1c1", "b3L", "h0Lb4Re2d2", "b3L", "h0Lb4Rg3L", "b3L", "h0Lb4Re1U", "b3L", "h0Lb4Re1R", "c4c3", "h0Lb4Re1f1", "b3L", "h0Lb4Rd1L", "c4c3", "h0La7b7d1R", "b3L", "h0La7b7g4L", "c4R", "h0La7b7e1L", "b3L", "h0La7b7f2L", "b3L", "h0La7b7d1c1", "b3L", "h0La7b7d1L", "b3L", "h0La7b7d1U", "b3L", "h0La7b7f2U", "b3L", "h0La7b7f2R", "b3L", "h0La7b7g3L", "b3L", "h0Lb3Ud1R", "b3R", "h0Lb3Ue1R", "b4a3", "h0Lb3Ud1c1", "b3R", "h0Lb3Ue1L", "b3R", "h0Lb3Ue2L", "a7b7", "h0Lb3Uh0h1", "b3R", "h0Lb3Ue1U", "b3R", "h0Lb3Ue1f1", "b3R", "h0Lb3Ud1L", "b3R", "h0Lb3Ud1U", "b3R", "h0Lb3Rd1R", "b3U", "h0Lb3Rd1c1", "b3U", "h0Lb3Rh0h1", "b3U", "h0Lb3Re1L", "b3U", "h0Lb3Re1R", "b3U", "h0Lb3Re2L", "a7b7", "h0Lb3Re1U", "b3U", "h0Lb3Re1f1", "b3U", "h0Lb3Rd1L", "b3U", "h0Lb3Rd1U", "b3U", "h0Lc4Rg4L", "b3L", "h0Lc4Rd1R", "b3L", "h0Lc4Rd1c1", "b3L", "h0Lc4Re2L", "a7b7", "h0Lc4Re2d2", "b3L", "h0Lc4Rg4g5", "b3L", "h0Lc4Rh0h1", "a7b7", "h0Lc4Rg3f4", "b3L", "h0Lc4Re1L", "b3L", "h0Lc4Rd1d2", "a7b7", "h0Lb4Ud1R", "b3L", "h0Lb4Ud1c1", "b4U", "h0Lb4Ue1R", "b3L", "h0Lb4Ue2L", "b3L", "h0Lb4Ue1L", "b3L", "h0Lb4Uh0h1", "b3L", "h0Lb4Ue1U", "b3L", "h0Lb4Ue1f1", "b3L", "h0Lb4Ud1L", "b3L", "h0Lb4Ud1U", "b3L", "h0Lb4b5d1R", "b3L", "h0Lb4b5e2L", "b3L", "h0Lb4b5e1R", "b3L", "h0Lb4b5d1c1", "b3L", "h0Lb4b5e1L", "b3L", "h0Lb4b5h0h1", "b3L", "h0Lb4b5e1U", "b3L", "h0Lb4b5e1f1", "b3L", "h0Lb4b5d1L", "b3L", "h0Lb4b5d1U", "b3L", "h0g0b3Lf2R", "b3b2", "h0g0b3Le1e0", "a7b7", "h0g0b3Le1d0", "c4R", "h0g0b3Lg4L", "b3a2", "h0g0b3Lf3R", "b3a2", "h0g0b3Lg0h1", "b3a2", "h0g0b3Ld1c1", "a7b6", "h0g0b3Le1L", "b3a2", "h0g0b3Lg4g5", "b3a2", "h0g0b3Le1R", "b3a2", "h0g0e6Rf3R", "b4R", "h0g0e6Rg4L", "b3b2", "h0g0e6Rf2R", "b3L", "h0g0e6Rf3f4", "b3L", "h0g0e6Re1L", "b3L", "h0g0e6Re1U", "a7L", "h0g0e6Re1R", "b3L", "h0g0e6Rd1L", "a7L", "h0g0e6Rd1U", "b3L", "h0g0e6Rd1c1", "a7L", "h0g0a7b6g4L", "b3L", "h0g0a7b6f3R", "b3L", "h0g0a7b6f2R", "b3L", "h0g0a7b6e2R", "b3L", "h0g0a7b6f3f4", "b3L", "h0g0a7b6f2e3", "e6R", "h0g0a7b6g4U", "b3L", "h0g0a7b6g4f4", "c4R", "h0g0a7b6d1d2", "c4R", "h0g0a7b6f3L", "b3L", "h0g0d5e4g4L", "b3L", "h0g0d5e4e1d2", "b3L", "h0g0d5e4d1d2", "b3L", "h0g0d5e4f2R", "b3L", "h0g0d5e4e2d2", "b3L", "h0g0d5e4f3R", "b3L", "h0g0d5e4f3e4U", "b3L", "h0g0d5e4f3e4R", "b3L", "h0g0d5e4f3e4d4", "b3L", "h0g0d5e4e1L", "b3L", "h0g0b4Rf3R", "b3L", "h0g0b4Rf2e3", "b4c3", "h0g0b4Rd1R", "b3L", "h0g0b4Rg4L", "b3L", "h0g0b4Rd1d2", "b3L", "h0g0b4Rf2R", "b3L", "h0g0b4Re2d2", "b3L", "h0g0b4Rg4U", "b3L", "h0g0b4Rd1U", "b3L", "h0g0b4Rf3f4", "b3L", "h0g0a7b7f3R", "b3L", "h0g0a7b7f3f4", "c4R", "h0g0a7b7g4L", "b3L", "h0g0a7b7d1c1", "c4R", "h0g0a7b7f2R", "b3L", "h0g0a7b7g0h0", "c4R", "h0g0a7b7e2R", "b3L", "h0g0a7b7g4U", "b3L", "h0g0a7b7g0g1", "b3L", "h0g0a7b7f2e3", "c4R", "h0g0c4d4f3R", "b3L", "h0g0c4d4e2d2", "b3L", "h0g0c4d4g4L", "b3L", "h0g0c4d4d1d2", "b3L", "h0g0c4d4f2R", "b3L", "h0g0c4d4f2e3", "b3b2", "h0g0c4d4e2R", "b3L", "h0g0c4d4e1L", "b3L", "h0g0c4d4e1U", "b3L", "h0g0c4d4e1R", "b3b2", "h0g0b4c3f2e3", "b3L", "h0g0b4c3g4L", "b3L", "h0g0b4c3d1R", "c4R", "h0g0b4c3g0L", "b3L", "h0g0b4c3g4U", "b3L", "h0g0b4c3f3R", "b3L", "h0g0b4c3g0h0", "b3L", "h0g0b4c3d1c1", "b3L", "h0g0b4c3f2R", "b3L", "h0g0b4c3g4f4", "b3L", "h0g0d5d4f3R", "b3L", "h0g0d5d4g4L", "b3L", "h0g0d5d4e2d2", "b3L", "h0g0d5d4d1d2", "b3L", "h0g0d5d4f2R", "b3L", "h0g0d5d4f2e3", "b3L", "h0g0d5d4e2R", "b3L", "h0g0d5d4d1R", "b3L", "h0g0d5d4d1c0", "b3L", "h0g0d5d4e1L", "b3L", "h0g0e6e5f2e3", "b3L", "h0g0e6e5f3R", "b3L", "h0g0e6e5g4L", "b3L", "h0g0e6e5d1d2", "b3L", "h0g0e6e5e2d2", "b3L", "h0g0e6e5d1R", "b3L", "h0g0e6e5f2R", "b3L", "h0g0e6e5d1U", "b3L", "h0g0e6e5d1c1", "b3L", "h0g0e6e5e1L", "b3L"};
-
-char* lookup_table_depth_5[] = {"g4Lb3Lg4g5b3b2", "e2d2", "g4Lb3Lg4g5d6e7", "g3g4", "g4Lb3Lg4g5b4L", "g3R", "g4Lb3Lg4g5b4R", "g5g6", "g4Lb3Lg4g5d6d7", "d1c1", "g4Lb3Lg4h5b3b2", "d1c2", "g4Lb3Lg4h5d6e7", "d1c1", "g4Lb3Lg4h5d6d7", "f3e4", "g4Lb3Lg4h5b4L", "d1c2", "g4Lb3Lg4h5d6c7", "d1c1", "g4Lb3Le1d0e6f6", "g4h5", "g4Lb3Le1d0d5e5", "g4g5", "g4Lb3Le1d0b3b2", "g3f4", "g4Lb3Le1d0d6e7", "h0g0", "g4Lb3Le1d0d6d7", "g4h5", "g4Lb3Le2d2b3b2", "g4g5", "g4Lb3Le2d2c4d4", "d1c2", "g4Lb3Le2d2e6f6", "f3e3", "g4Lb3Le2d2b3a3", "d2c2", "g4Lb3Le2d2b4R", "g4g5", "g4Lb3Le1e0b3b2", "g4g5", "g4Lb3Le1e0e6f6", "g3f4", "g4Lb3Le1e0d5e5", "h0g1", "g4Lb3Le1e0d6e7", "g3R", "g4Lb3Le1e0d6d7", "g4h4", "g4Ld6e7f3e3b3L", "e2d2", "g4Ld6e7f3e3e7f7", "e3f4", "g4Ld6e7f3e3a7L", "g4h4", "g4Ld6e7f3e3b3b2", "e3L", "g4Ld6e7f3e3a7b7", "g4h5", "g4Ld6e7g4h4b3L", "e2d3", "g4Ld6e7g4h4a7b7", "g3f4", "g4Ld6e7g4h4c5R", "f2e3", "g4Ld6e7g4h4e7f6", "e2d3", "g4Ld6e7g4h4b4R", "f2e3", "g4Ld6e7f2e3b3L", "g4h4", "g4Ld6e7f2e3b3b2", "g4h4", "g4Ld6e7f2e3a7L", "g4h4", "g4Ld6e7f2e3e6f6", "g4h4", "g4Ld6e7f2e3e7f7", "e3d3", "g4Ld6e7g4g5b3L", "e1d0", "g4Ld6e7g4g5b3b2", "d1c2", "g4Ld6e7g4g5a7L", "g5h4", "g4Ld6e7g4g5b3U", "g5h6", "g4Ld6e7g4g5b3R", "g5h6", "g4Ld6e7h0g1b3L", "f3R", "g4Ld6e7h0g1b3b2", "g3f4", "g4Ld6e7h0g1b4R", "f3R", "g4Ld6e7h0g1a7L", "d1c2", "g4Ld6e7h0g1e7d6", "g3f4", "g4Ld6d7g4h5b3L", "f3e4", "g4Ld6d7g4h5b4R", "e2d3", "g4Ld6d7g4h5e6f5", "g3g4", "g4Ld6d7g4h5a7L", "e2d3", "g4Ld6d7g4h5d7e7", "e2d3", "g4Ld6d7g4g5b3L", "d1c1", "g4Ld6d7g4g5d7e7", "f3e4", "g4Ld6d7g4g5b3b2", "d1c2", "g4Ld6d7g4g5b4L", "g5h6", "g4Ld6d7g4g5b4R", "g3R", "g4Ld6d7f3e3b3L", "g4h5", "g4Ld6d7f3e3b3b2", "d1c2", "g4Ld6d7f3e3a7b7", "g3R", "g4Ld6d7f3e3b4R", "g4g5", "g4Ld6d7f3e3b4c3", "g4h5", "g4Ld6d7f2e3b3L", "h0g1", "g4Ld6d7f2e3b3b2", "e1d0", "g4Ld6d7f2e3b4L", "g4h4", "g4Ld6d7f2e3d7e7", "g4h4", "g4Ld6d7f2e3b3U", "g4h4", "g4Ld6d7h0g1b3L", "f3R", "g4Ld6d7h0g1d7d6", "g3f4", "g4Ld6d7h0g1b3b2", "d1c2", "g4Ld6d7h0g1b4R", "f3R", "g4Ld6d7h0g1d7e7", "f3R", "g4Ld6c7g4h5b3L", "d1c1", "g4Ld6c7g4h5b4R", "e2d3", "g4Ld6c7g4h5a7L", "e2d3", "g4Ld6c7g4h5b3b2", "d1c1", "g4Ld6c7g4h5e6f6", "e2d3", "g4Ld6c7g4g5b3L", "d1c2", "g4Ld6c7g4g5b3b2", "d1c2", "g4Ld6c7g4g5c7d7", "f3e4", "g4Ld6c7g4g5b4R", "e1d0", "g4Ld6c7g4g5a7L", "g3f4", "g4Ld6c7f3e3b3L", "e3L", "g4Ld6c7f3e3b3b2", "d1c2", "g4Ld6c7f3e3b4R", "h0g1", "g4Ld6c7f3e3a7b7", "g4h5", "g4Ld6c7f3e3b4c3", "g4g5", "g4Ld6c7f2e3b3L", "h0g1", "g4Ld6c7f2e3b3b2", "d1c2", "g4Ld6c7f2e3b4L", "g4h4", "g4Ld6c7f2e3c7L", "g4h5", "g4Ld6c7f2e3b3U", "e3d3", "g4Ld6c7g4h4b3L", "e2d3", "g4Ld6c7g4h4c7L", "e2d3", "g4Ld6c7g4h4c7b6", "e2d3", "g4Ld6c7g4h4a7b7", "g3f4", "g4Ld6c7g4h4e6f6", "f2e3", "g4La7a6g4h5a6L", "g3f4", "g4La7a6g4h5b3L", "f3e4", "g4La7a6g4h5b4R", "e2d3", "g4La7a6g4h5e6L", "e2d3", "g4La7a6g4h5e6f6", "e2d3", "g4La7a6g4g5b3L", "e2d2", "g4La7a6g4g5a6L", "g5h4", "g4La7a6g4g5e6L", "d1c1", "g4La7a6g4g5e6e5", "g5h5", "g4La7a6g4g5d6e7", "g5h6", "g4La7a6e1Lb3L", "g4h5", "g4La7a6e1Lb3b2", "d1c1", "g4La7a6e1Le6R", "g3f4", "g4La7a6e1La6L", "g4h5", "g4La7a6e1Lb4L", "g4h5", "g4La7a6g4h4b3L", "f2e3", "g4La7a6g4h4a6L", "d1c2", "g4La7a6g4h4e6f5", "e2d3", "g4La7a6g4h4a6b7", "h4h5", "g4La7a6g4h4a6b6", "g3f4", "g4La7a6g3f4b3L", "f3R", "g4La7a6g3f4b3b2", "h0g1", "g4La7a6g3f4e6R", "h0g0", "g4La7a6g3f4a6L", "h0g0", "g4La7a6g3f4b4R", "f3R", "g4g5b3Lg5Lb3b2", "e1d0", "g4g5b3Lg5Ld6d7", "e1d0", "g4g5b3Lg5Ld6e7", "e2d2", "g4g5b3Lg5Lb4L", "g3R", "g4g5b3Lg5Lb4R", "g5g6", "g4g5b3Lg5g6e6f6", "g6f6L", "g4g5b3Lg5g6e6f7", "g6L", "g4g5b3Lg5g6e6f5", "g6f5L", "g4g5b3Lg5g6b3a3", "g6L", "g4g5b3Lg5g6b3b2", "g6L", "g4g5b3Lg3f4b3b2", "g5L", "g4g5b3Lg3f4b3a2", "g5L", "g4g5b3Lg3f4d6e7", "g5L", "g4g5b3Lg3f4b4c3", "g5L", "g4g5b3Lg3f4d5e5", "g5L", "g4g5b3Le1d0e6f5", "g5L", "g4g5b3Le1d0e6f6", "g5f6L", "g4g5b3Le1d0b3b2", "g5L", "g4g5b3Le1d0d6e7", "g5L", "g4g5b3Le1d0d5e5", "d0L", "g4g5b3Ld1c1b3c2", "g5L", "g4g5b3Ld1c1b3b2", "g5L", "g4g5b3Ld1c1e6f6", "g5L", "g4g5b3Ld1c1e6f5", "g3R", "g4g5b3Ld1c1b4R", "g5L", "g4g5d6e7g5Lb3L", "e2d2", "g4g5d6e7g5Lb3b2", "d1c2", "g4g5d6e7g5La7L", "g5h4", "g4g5d6e7g5Lb3U", "g5h6", "g4g5d6e7g5Lb3R", "g5h6", "g4g5d6e7g5g6b3L", "g6L", "g4g5d6e7g5g6b3b2", "g6L", "g4g5d6e7g5g6b4L", "g6L", "g4g5d6e7g5g6d5e5", "g6L", "g4g5d6e7g5g6b4R", "g6L", "g4g5d6e7e1Lb3L", "g5L", "g4g5d6e7e1Lb3b2", "e1d0", "g4g5d6e7e1Lb4R", "g5L", "g4g5d6e7e1Lb4L", "g5L", "g4g5d6e7e1Le7f7", "g3R", "g4g5d6e7e1Ub3L", "g5L", "g4g5d6e7e1Ub3b2", "g5L", "g4g5d6e7e1Ud5e5", "g5L", "g4g5d6e7e1Ub4R", "g5L", "g4g5d6e7e1Ub3U", "g5L", "g4g5d6e7e1Rb3L", "g5L", "g4g5d6e7e1Rb3b2", "g5L", "g4g5d6e7e1Rb4L", "g5L", "g4g5d6e7e1Rb4R", "g5L", "g4g5d6e7e1Rd5e5", "g5L", "g4g5d6d7g5Lb3L", "g3g4", "g4g5d6d7g5Lb4L", "g5h6", "g4g5d6d7g5Ld7e7", "f3e4", "g4g5d6d7g5Lb3b2", "d1c2", "g4g5d6d7g5Lb4R", "g5g6", "g4g5d6d7g3Rb3L", "f3R", "g4g5d6d7g3Rb3b2", "f3R", "g4g5d6d7g3Rb4R", "f3R", "g4g5d6d7g3Rd5e5", "f3R", "g4g5d6d7g3Ra7L", "f3R", "g4g5d6d7d1d2b3L", "g5L", "g4g5d6d7d1d2b3b2", "h0g1", "g4g5d6d7d1d2b4L", "g5L", "g4g5d6d7d1d2c4d4", "g5L", "g4g5d6d7d1d2d7e7", "g5L", "g4g5d6d7g5Ub3L", "g5R", "g4g5d6d7g5Ub3b2", "e1f0", "g4g5d6d7g5Ud7e7", "g5R", "g4g5d6d7g5Ub4L", "g5R", "g4g5d6d7g5Ud5e5", "d1c2", "g4g5d6d7e1Lb3L", "g5L", "g4g5d6d7e1Lb3b2", "g5L", "g4g5d6d7e1Lb4R", "g5L", "g4g5d6d7e1Lb4L", "g5L", "g4g5d6d7e1Ld7e7", "g5L", "g4g5e6f6g5La7L", "g3f4", "g4g5e6f6g5La7a6", "h0g1", "g4g5e6f6g5Ld6e7", "g3f4", "g4g5e6f6g5Lb3L", "g3f4", "g4g5e6f6g5La7b6", "g3f4", "g4g5e6f6g5f6La7b6", "d1R", "g4g5e6f6g5f6La7L", "f6g5h4", "g4g5e6f6g5f6Ld6e7", "f6g6", "g4g5e6f6g5f6Lg5h5", "h0g1", "g4g5e6f6g5f6La7a6", "d1R", "g4g5e6f6g3g4b3L", "g5L", "g4g5e6f6g3g4a7b6", "g5L", "g4g5e6f6g3g4f6U", "g5L", "g4g5e6f6g3g4a7b7", "g5L", "g4g5e6f6g3g4a7L", "h0g0", "g4g5e6f6f3Rb3L", "g3R", "g4g5e6f6f3Rf6g5h5", "g3R", "g4g5e6f6f3Ra7b7", "g5L", "g4g5e6f6f3Ra7b6", "h0g1", "g4g5e6f6f3Rf6g5h4", "h0g1", "g4g5e6f6g5g4b3L", "g4L", "g4g5e6f6g5g4f6R", "g4L", "g4g5e6f6g5g4a7L", "g4L", "g4g5e6f6g5g4b3b2", "g4L", "g4g5e6f6g5g4d5e5", "h0L", "g4g5e6f5g5f5g6a7b6", "d1R", "g4g5e6f5g5f5g6g5g6f6", "g5L", "g4g5e6f5g5f5g6g5g6f5", "g5f5L", "g4g5e6f5g5f5g6g5g6h5", "g5L", "g4g5e6f5g5f5g6a7L", "g6g5L", "g4g5e6f5g5La7b6", "g5f5f4", "g4g5e6f5g5La7L", "f3R", "g4g5e6f5g5Lf5g5h5", "h0g1", "g4g5e6f5g5La7a6", "h0g0", "g4g5e6f5g5Lf5g5h4", "h0g1", "g4g5e6f5g5f5La7b6", "h0g1", "g4g5e6f5g5f5La7L", "f3R", "g4g5e6f5g5f5La7a6", "g3h4", "g4g5e6f5g5f5Lg5h5", "h0g1", "g4g5e6f5g5f5Ld6e7", "g3g4", "g4g5e6f5g5f5g4b3L", "g4L", "g4g5e6f5g5f5g4g5f6", "g4L", "g4g5e6f5g5f5g4g5f4", "g4L", "g4g5e6f5g5f5g4g5h4", "g4L", "g4g5e6f5g5f5g4a7b7", "g4g5L", "g4g5e6f5d1Rb3L", "h0L", "g4g5e6f5d1Rf5g5h5", "h0L", "g4g5e6f5d1Ra7b7", "h0L", "g4g5e6f5d1Ra7b6", "h0L", "g4g5e6f5d1Rc4d4", "h0L", "d1d2b3Lg4Lb3b2", "d2d1", "d1d2b3Lg4Lb3a3", "d2c2", "d1d2b3Lg4Ld6d7", "h0g1", "d1d2b3Lg4Lb4L", "g4g5", "d1d2b3Lg4Le6f6", "g4f5", "d1d2b3Lh0h1b3a2", "g4L", "d1d2b3Lh0h1b3b2", "h1L", "d1d2b3Lh0h1b3a3", "g4L", "d1d2b3Lh0h1e6R", "g4L", "d1d2b3Lh0h1c4d4", "g4L", "d1d2b3Lh0Lb3a2", "h0h1", "d1d2b3Lh0Lb3a3", "d2c2", "d1d2b3Lh0Lb4c3", "h0h1", "d1d2b3Lh0La7b6", "d2R", "d1d2b3Lh0Lb3b2", "h0h1", "d1d2b3Le1d1b3b2", "h0h1", "d1d2b3Le1d1b3a2", "h0L", "d1d2b3Le1d1d6e5", "d2c3", "d1d2b3Le1d1c4d3", "h0g1", "d1d2b3Le1d1c4d4", "h0h1", "d1d2b3Ld2c1b3b2", "h0h1", "d1d2b3Ld2c1b3c2", "g4L", "d1d2b3Ld2c1c5d4", "g4L", "d1d2b3Ld2c1a7b7", "g4L", "d1d2b3Ld2c1b3a3", "g4L", "d1d2b3b2h0Lb2L", "h0h1", "d1d2b3b2h0Lb2b1", "d2c1", "d1d2b3b2h0Lb4R", "d2c3", "d1d2b3b2h0Lc4U", "d2c2", "d1d2b3b2h0Lc4d4", "e1L", "d1d2b3b2h0g1b2L", "g4L", "d1d2b3b2h0g1e6R", "g4L", "d1d2b3b2h0g1b4b3", "f3R", "d1d2b3b2h0g1c4d4", "g4L", "d1d2b3b2h0g1b4c3", "g4L", "d1d2b3b2d2c1b2L", "h0h1", "d1d2b3b2d2c1b2c1L", "g4L", "d1d2b3b2d2c1b2c1b1", "h0h1", "d1d2b3b2d2c1b2b3", "g4L", "d1d2b3b2d2c1c4R", "g4L", "d1d2b3b2d2c3b2L", "h0g1", "d1d2b3b2d2c3b2c3L", "h0g1", "d1d2b3b2d2c3b2b1", "h0L", "d1d2b3b2d2c3c4c3U", "g4L", "d1d2b3b2d2c3b4c3L", "b4c3R", "d1d2b3b2d2c2b2L", "h0g1", "d1d2b3b2d2c2b2c2L", "h0h1", "d1d2b3b2d2c2b2c2b3", "g4L", "d1d2b3b2d2c2b2c2b1", "h0g1", "d1d2b3b2d2c2e6R", "g4L", "d1d2c4d4g4Lb3L", "d2c3", "d1d2c4d4g4Ld4L", "g4h5", "d1d2c4d4g4Le6e5", "g4g5", "d1d2c4d4g4Ld4c4", "g4h5", "d1d2c4d4g4Le6f5", "g4f5g5", "d1d2c4d4g4g5b3L", "g5L", "d1d2c4d4g4g5d6e7", "g5L", "d1d2c4d4g4g5d6d7", "g5L", "d1d2c4d4g4g5e6f6", "g5L", "d1d2c4d4g4g5e6f5", "g5L", "d1d2c4d4h0g0b3L", "g4L", "d1d2c4d4h0g0b3b2", "d2c3", "d1d2c4d4h0g0b4R", "f3R", "d1d2c4d4h0g0e6e5", "f3e4", "d1d2c4d4h0g0a7b7", "g4L", "d1d2c4d4e2d3b3L", "g4L", "d1d2c4d4e2d3b3b2", "h0h1", "d1d2c4d4e2d3a7b7", "g4L", "d1d2c4d4e2d3b4L", "g4L", "d1d2c4d4e2d3d4e5", "g4L", "d1d2c4d4g3Lb3L", "g4L", "d1d2c4d4g3Lb3b2", "h0L", "d1d2c4d4g3Lb4R", "g4L", "d1d2c4d4g3Lb4L", "g4L", "d1d2c4d4g3Le6e5", "g4L", "d1d2b4Rg4Lb3L", "g4g5", "d1d2b4Rg4Ld6e7", "d2c3", "d1d2b4Rg4Ld6d7", "d2c3", "d1d2b4Rg4Ld5d4", "g4g5", "d1d2b4Rg4Ld6c7", "g4h4", "d1d2b4Rg4g5b3L", "g5L", "d1d2b4Rg4g5d6e7", "g5L", "d1d2b4Rg4g5d6d7", "g5L", "d1d2b4Rg4g5c4R", "g5L", "d1d2b4Rg4g5a7a6", "g5L", "d1d2b4Rg3Rb3L", "f3R", "d1d2b4Rg3Re6R", "g4U", "d1d2b4Rg3Rb3U", "g4L", "d1d2b4Rg3Rc4R", "g4L", "d1d2b4Rg3Rb3R", "g4L", "d1d2b4Rh0g0b3L", "g4L", "d1d2b4Rh0g0b3R", "g4L", "d1d2b4Rh0g0b3U", "g4L", "d1d2b4Rh0g0c4R", "g4L", "d1d2b4Rh0g0b4c3", "d2c3b4", "d1d2b4Rd2d3b3L", "d3c4b5", "d1d2b4Rd2d3b3U", "g4L", "d1d2b4Rd2d3b3R", "g4L", "d1d2b4Rd2d3d5d4", "g4L", "d1d2b4Rd2d3b4U", "g4L", "d1d2e6Rg4La7L", "d2R", "d1d2e6Rg4Ld6L", "g4h4", "d1d2e6Rg4La7a6", "d2c3", "d1d2e6Rg4Ld5L", "g4g5", "d1d2e6Rg4Lb3L", "g4g5", "d1d2e6Rd2d1e6f6", "g4L", "d1d2e6Rd2d1a7L", "g4L", "d1d2e6Rd2d1b3L", "g4L", "d1d2e6Rd2d1b3b2", "g4L", "d1d2e6Rd2d1d6R", "g4L", "d1d2e6Rd2c1a7L", "c1R", "d1d2e6Rd2c1e6f6", "g4L", "d1d2e6Rd2c1e6e7", "h0L", "d1d2e6Rd2c1d6R", "g4L", "d1d2e6Rd2c1a7a6", "h0L", "d1d2e6Rf3e4b3L", "g4L", "d1d2e6Rf3e4a7L", "h0g0", "d1d2e6Rf3e4b3b2", "h0g1", "d1d2e6Rf3e4e6e7", "e4d5e5", "d1d2e6Rf3e4e6f6", "g4L", "d1d2e6Rh0g0a7L", "d2R", "d1d2e6Rh0g0b3L", "d2c3", "d1d2e6Rh0g0e6e7", "d2R", "d1d2e6Rh0g0e6f6", "g4L", "d1d2e6Rh0g0d6L", "g4L", "e2d2b3Lg4Lb3b2", "g4g5", "e2d2b3Lg4Le6f6", "f3e3", "e2d2b3Lg4Lb3a3", "d2c2", "e2d2b3Lg4Ld6e7", "d1c2", "e2d2b3Lg4Lc4d4", "d1c2", "e2d2b3Le1d0b3a2", "g4L", "e2d2b3Le1d0c4d3", "d2d3e2", "e2d2b3Le1d0c5d4", "g4L", "e2d2b3Le1d0a7b6", "g4L", "e2d2b3Le1d0b3b2", "g4L", "e2d2b3Le1f0b3a2", "g4L", "e2d2b3Le1f0b3b2", "g4L", "e2d2b3Le1f0c4d3", "g4L", "e2d2b3Le1f0c5d4", "g4L", "e2d2b3Le1f0a7b6", "g4L", "e2d2b3Le1e0b3a2", "g4L", "e2d2b3Le1e0c4d3", "g4L", "e2d2b3Le1e0b3b2", "g4L", "e2d2b3Le1e0c5d4", "g4L", "e2d2b3Le1e0a7b6", "g4L", "e2d2b3Lh0h1b3a2", "g4L", "e2d2b3Lh0h1b3b2", "d1c2", "e2d2b3Lh0h1b4R", "g4L", "e2d2b3Lh0h1b3a3", "g4L", "e2d2b3Lh0h1c5d4", "g4L", "e2d2b3b2e1d0b2L", "g4L", "e2d2b3b2e1d0d6e5", "g4L", "e2d2b3b2e1d0c4d4", "g4L", "e2d2b3b2e1d0b4R", "g4L", "e2d2b3b2e1d0b2U", "g4L", "e2d2b3b2g4Lb2L", "g4g5", "e2d2b3b2g4Lb2b1", "e1d0", "e2d2b3b2g4La7a6", "g4h4", "e2d2b3b2g4Ld6e7", "d1c2", "e2d2b3b2g4Ld6d7", "d2c3", "e2d2b3b2e1e0b2L", "g4L", "e2d2b3b2e1e0c4d4", "g4L", "e2d2b3b2e1e0e6R", "g4L", "e2d2b3b2e1e0b2U", "g4L", "e2d2b3b2e1e0b2R", "g4L", "e2d2b3b2d1c1b2L", "h0L", "e2d2b3b2d1c1b2c1L", "g4L", "e2d2b3b2d1c1b2c1b1", "h0L", "e2d2b3b2d1c1b2b3", "g4L", "e2d2b3b2d1c1b4b3", "h0L", "e2d2b3b2e1f0b2L", "g4L", "e2d2b3b2e1f0c4d4", "g4L", "e2d2b3b2e1f0d6e5", "g4L", "e2d2b3b2e1f0b2b1", "g4L", "e2d2b3b2e1f0b4R", "g4L"};
-
-char* lookup_table_depth_6[] = {"g4Lb3Lg4g5b3b2", "e2d2", "g4Lb3Lg4g5d6e7", "g3g4", "g4Lb3Lg4g5b4L", "g3R", "g4Lb3Lg4g5b4R", "g5g6", "g4Lb3Lg4g5d6d7", "d1c1", "g4Lb3Lg4h5b3b2", "d1c2", "g4Lb3Lg4h5d6e7", "d1c1", "g4Lb3Lg4h5d6d7", "f3e4", "g4Lb3Lg4h5b4L", "d1c2", "g4Lb3Lg4h5d6c7", "d1c1", "g4Lb3Le1d0e6f6", "g4h5", "g4Lb3Le1d0d5e5", "g4g5", "g4Lb3Le1d0b3b2", "g3f4", "g4Lb3Le1d0d6e7", "h0g0", "g4Lb3Le1d0d6d7", "g4h5", "g4Lb3Le2d2b3b2", "g4g5", "g4Lb3Le2d2c4d4", "d1c2", "g4Lb3Le2d2e6f6", "f3e3", "g4Lb3Le2d2b3a3", "d2c2", "g4Lb3Le2d2b4R", "g4g5", "g4Lb3Le1e0b3b2", "g4g5", "g4Lb3Le1e0e6f6", "g3f4", "g4Lb3Le1e0d5e5", "h0g1", "g4Lb3Le1e0d6e7", "g3R", "g4Lb3Le1e0d6d7", "g4h4", "g4Ld6e7f3e3b3L", "e2d2", "g4Ld6e7f3e3e7f7", "e3f4", "g4Ld6e7f3e3a7L", "g4h4", "g4Ld6e7f3e3b3b2", "e3L", "g4Ld6e7f3e3a7b7", "g4h5", "g4Ld6e7g4h4b3L", "e2d3", "g4Ld6e7g4h4a7b7", "g3f4", "g4Ld6e7g4h4c5R", "f2e3", "g4Ld6e7g4h4e7f6", "e2d3", "g4Ld6e7g4h4b4R", "f2e3", "g4Ld6e7f2e3b3L", "g4h4", "g4Ld6e7f2e3b3b2", "g4h4", "g4Ld6e7f2e3a7L", "g4h4", "g4Ld6e7f2e3e6f6", "g4h4", "g4Ld6e7f2e3e7f7", "e3d3", "g4Ld6e7g4g5b3L", "e1d0", "g4Ld6e7g4g5b3b2", "d1c2", "g4Ld6e7g4g5a7L", "g5h4", "g4Ld6e7g4g5b3U", "g5h6", "g4Ld6e7g4g5b3R", "g5h6", "g4Ld6e7h0g1b3L", "f3R", "g4Ld6e7h0g1b3b2", "g3f4", "g4Ld6e7h0g1b4R", "f3R", "g4Ld6e7h0g1a7L", "d1c2", "g4Ld6e7h0g1e7d6", "g3f4", "g4Ld6d7g4h5b3L", "f3e4", "g4Ld6d7g4h5b4R", "e2d3", "g4Ld6d7g4h5e6f5", "g3g4", "g4Ld6d7g4h5a7L", "e2d3", "g4Ld6d7g4h5d7e7", "e2d3", "g4Ld6d7g4g5b3L", "d1c1", "g4Ld6d7g4g5d7e7", "f3e4", "g4Ld6d7g4g5b3b2", "d1c2", "g4Ld6d7g4g5b4L", "g5h6", "g4Ld6d7g4g5b4R", "g3R", "g4Ld6d7f3e3b3L", "g4h5", "g4Ld6d7f3e3b3b2", "d1c2", "g4Ld6d7f3e3a7b7", "g3R", "g4Ld6d7f3e3b4R", "g4g5", "g4Ld6d7f3e3b4c3", "g4h5", "g4Ld6d7f2e3b3L", "h0g1", "g4Ld6d7f2e3b3b2", "e1d0", "g4Ld6d7f2e3b4L", "g4h4", "g4Ld6d7f2e3d7e7", "g4h4", "g4Ld6d7f2e3b3U", "g4h4", "g4Ld6d7h0g1b3L", "f3R", "g4Ld6d7h0g1d7d6", "g3f4", "g4Ld6d7h0g1b3b2", "d1c2", "g4Ld6d7h0g1b4R", "f3R", "g4Ld6d7h0g1d7e7", "f3R", "g4Ld6c7g4h5b3L", "d1c1", "g4Ld6c7g4h5b4R", "e2d3", "g4Ld6c7g4h5a7L", "e2d3", "g4Ld6c7g4h5b3b2", "d1c1", "g4Ld6c7g4h5e6f6", "e2d3", "g4Ld6c7g4g5b3L", "d1c2", "g4Ld6c7g4g5b3b2", "d1c2", "g4Ld6c7g4g5c7d7", "f3e4", "g4Ld6c7g4g5b4R", "e1d0", "g4Ld6c7g4g5a7L", "g3f4", "g4Ld6c7f3e3b3L", "e3L", "g4Ld6c7f3e3b3b2", "d1c2", "g4Ld6c7f3e3b4R", "h0g1", "g4Ld6c7f3e3a7b7", "g4h5", "g4Ld6c7f3e3b4c3", "g4g5", "g4Ld6c7f2e3b3L", "h0g1", "g4Ld6c7f2e3b3b2", "d1c2", "g4Ld6c7f2e3b4L", "g4h4", "g4Ld6c7f2e3c7L", "g4h5", "g4Ld6c7f2e3b3U", "e3d3", "g4Ld6c7g4h4b3L", "e2d3", "g4Ld6c7g4h4c7L", "e2d3", "g4Ld6c7g4h4c7b6", "e2d3", "g4Ld6c7g4h4a7b7", "g3f4", "g4Ld6c7g4h4e6f6", "f2e3", "g4La7a6g4h5a6L", "g3f4", "g4La7a6g4h5b3L", "f3e4", "g4La7a6g4h5b4R", "e2d3", "g4La7a6g4h5e6L", "e2d3", "g4La7a6g4h5e6f6", "e2d3", "g4La7a6g4g5b3L", "e2d2", "g4La7a6g4g5a6L", "g5h4", "g4La7a6g4g5e6L", "d1c1", "g4La7a6g4g5e6e5", "g5h5", "g4La7a6g4g5d6e7", "g5h6", "g4La7a6e1Lb3L", "g4h5", "g4La7a6e1Lb3b2", "d1c1", "g4La7a6e1Le6R", "g3f4", "g4La7a6e1La6L", "g4h5", "g4La7a6e1Lb4L", "g4h5", "g4La7a6g4h4b3L", "f2e3", "g4La7a6g4h4a6L", "d1c2", "g4La7a6g4h4e6f5", "e2d3", "g4La7a6g4h4a6b7", "h4h5", "g4La7a6g4h4a6b6", "g3f4", "g4La7a6g3f4b3L", "f3R", "g4La7a6g3f4b3b2", "h0g1", "g4La7a6g3f4e6R", "h0g0", "g4La7a6g3f4a6L", "h0g0", "g4La7a6g3f4b4R", "f3R", "g4g5b3Lg5Lb3b2", "e1d0", "g4g5b3Lg5Ld6d7", "e1d0", "g4g5b3Lg5Ld6e7", "e2d2", "g4g5b3Lg5Lb4L", "g3R", "g4g5b3Lg5Lb4R", "g5g6", "g4g5b3Lg5g6e6f6", "g6f6L", "g4g5b3Lg5g6e6f7", "g6L", "g4g5b3Lg5g6e6f5", "g6f5L", "g4g5b3Lg5g6b3a3", "g6L", "g4g5b3Lg5g6b3b2", "g6L", "g4g5b3Lg3f4b3b2", "g5L", "g4g5b3Lg3f4b3a2", "g5L", "g4g5b3Lg3f4d6e7", "g5L", "g4g5b3Lg3f4b4c3", "g5L", "g4g5b3Lg3f4d5e5", "g5L", "g4g5b3Le1d0e6f5", "g5L", "g4g5b3Le1d0e6f6", "g5f6L", "g4g5b3Le1d0b3b2", "g5L", "g4g5b3Le1d0d6e7", "g5L", "g4g5b3Le1d0d5e5", "d0L", "g4g5b3Ld1c1b3c2", "g5L", "g4g5b3Ld1c1b3b2", "g5L", "g4g5b3Ld1c1e6f6", "g5L", "g4g5b3Ld1c1e6f5", "g3R", "g4g5b3Ld1c1b4R", "g5L", "g4g5d6e7g5Lb3L", "e2d2", "g4g5d6e7g5Lb3b2", "d1c2", "g4g5d6e7g5La7L", "g5h4", "g4g5d6e7g5Lb3U", "g5h6", "g4g5d6e7g5Lb3R", "g5h6", "g4g5d6e7g5g6b3L", "g6L", "g4g5d6e7g5g6b3b2", "g6L", "g4g5d6e7g5g6b4L", "g6L", "g4g5d6e7g5g6d5e5", "g6L", "g4g5d6e7g5g6b4R", "g6L", "g4g5d6e7e1Lb3L", "g5L", "g4g5d6e7e1Lb3b2", "e1d0", "g4g5d6e7e1Lb4R", "g5L", "g4g5d6e7e1Lb4L", "g5L", "g4g5d6e7e1Le7f7", "g3R", "g4g5d6e7e1Ub3L", "g5L", "g4g5d6e7e1Ub3b2", "g5L", "g4g5d6e7e1Ud5e5", "g5L", "g4g5d6e7e1Ub4R", "g5L", "g4g5d6e7e1Ub3U", "g5L", "g4g5d6e7e1Rb3L", "g5L", "g4g5d6e7e1Rb3b2", "g5L", "g4g5d6e7e1Rb4L", "g5L", "g4g5d6e7e1Rb4R", "g5L", "g4g5d6e7e1Rd5e5", "g5L", "g4g5d6d7g5Lb3L", "g3g4", "g4g5d6d7g5Lb4L", "g5h6", "g4g5d6d7g5Ld7e7", "f3e4", "g4g5d6d7g5Lb3b2", "d1c2", "g4g5d6d7g5Lb4R", "g5g6", "g4g5d6d7g3Rb3L", "f3R", "g4g5d6d7g3Rb3b2", "f3R", "g4g5d6d7g3Rb4R", "f3R", "g4g5d6d7g3Rd5e5", "f3R", "g4g5d6d7g3Ra7L", "f3R", "g4g5d6d7d1d2b3L", "g5L", "g4g5d6d7d1d2b3b2", "h0g1", "g4g5d6d7d1d2b4L", "g5L", "g4g5d6d7d1d2c4d4", "g5L", "g4g5d6d7d1d2d7e7", "g5L", "g4g5d6d7g5Ub3L", "g5R", "g4g5d6d7g5Ub3b2", "e1f0", "g4g5d6d7g5Ud7e7", "g5R", "g4g5d6d7g5Ub4L", "g5R", "g4g5d6d7g5Ud5e5", "d1c2", "g4g5d6d7e1Lb3L", "g5L", "g4g5d6d7e1Lb3b2", "g5L", "g4g5d6d7e1Lb4R", "g5L", "g4g5d6d7e1Lb4L", "g5L", "g4g5d6d7e1Ld7e7", "g5L", "g4g5e6f6g5La7L", "g3f4", "g4g5e6f6g5La7a6", "h0g1", "g4g5e6f6g5Ld6e7", "g3f4", "g4g5e6f6g5Lb3L", "g3f4", "g4g5e6f6g5La7b6", "g3f4", "g4g5e6f6g5f6La7b6", "d1R", "g4g5e6f6g5f6La7L", "f6g5h4", "g4g5e6f6g5f6Ld6e7", "f6g6", "g4g5e6f6g5f6Lg5h5", "h0g1", "g4g5e6f6g5f6La7a6", "d1R", "g4g5e6f6g3g4b3L", "g5L", "g4g5e6f6g3g4a7b6", "g5L", "g4g5e6f6g3g4f6U", "g5L", "g4g5e6f6g3g4a7b7", "g5L", "g4g5e6f6g3g4a7L", "h0g0", "g4g5e6f6f3Rb3L", "g3R", "g4g5e6f6f3Rf6g5h5", "g3R", "g4g5e6f6f3Ra7b7", "g5L", "g4g5e6f6f3Ra7b6", "h0g1", "g4g5e6f6f3Rf6g5h4", "h0g1", "g4g5e6f6g5g4b3L", "g4L", "g4g5e6f6g5g4f6R", "g4L", "g4g5e6f6g5g4a7L", "g4L", "g4g5e6f6g5g4b3b2", "g4L", "g4g5e6f6g5g4d5e5", "h0L", "g4g5e6f5g5f5g6a7b6", "d1R", "g4g5e6f5g5f5g6g5g6f6", "g5L", "g4g5e6f5g5f5g6g5g6f5", "g5f5L", "g4g5e6f5g5f5g6g5g6h5", "g5L", "g4g5e6f5g5f5g6a7L", "g6g5L", "g4g5e6f5g5La7b6", "g5f5f4", "g4g5e6f5g5La7L", "f3R", "g4g5e6f5g5Lf5g5h5", "h0g1", "g4g5e6f5g5La7a6", "h0g0", "g4g5e6f5g5Lf5g5h4", "h0g1", "g4g5e6f5g5f5La7b6", "h0g1", "g4g5e6f5g5f5La7L", "f3R", "g4g5e6f5g5f5La7a6", "g3h4", "g4g5e6f5g5f5Lg5h5", "h0g1", "g4g5e6f5g5f5Ld6e7", "g3g4", "g4g5e6f5g5f5g4b3L", "g4L", "g4g5e6f5g5f5g4g5f6", "g4L", "g4g5e6f5g5f5g4g5f4", "g4L", "g4g5e6f5g5f5g4g5h4", "g4L", "g4g5e6f5g5f5g4a7b7", "g4g5L", "g4g5e6f5d1Rb3L", "h0L", "g4g5e6f5d1Rf5g5h5", "h0L", "g4g5e6f5d1Ra7b7", "h0L", "g4g5e6f5d1Ra7b6", "h0L", "g4g5e6f5d1Rc4d4", "h0L", "d1d2b3Lg4Lb3b2", "d2d1", "d1d2b3Lg4Lb3a3", "d2c2", "d1d2b3Lg4Ld6d7", "h0g1", "d1d2b3Lg4Lb4L", "g4g5", "d1d2b3Lg4Le6f6", "g4f5", "d1d2b3Lh0h1b3a2", "g4L", "d1d2b3Lh0h1b3b2", "h1L", "d1d2b3Lh0h1b3a3", "g4L", "d1d2b3Lh0h1e6R", "g4L", "d1d2b3Lh0h1c4d4", "g4L", "d1d2b3Lh0Lb3a2", "h0h1", "d1d2b3Lh0Lb3a3", "d2c2", "d1d2b3Lh0Lb4c3", "h0h1", "d1d2b3Lh0La7b6", "d2R", "d1d2b3Lh0Lb3b2", "h0h1", "d1d2b3Le1d1b3b2", "h0h1", "d1d2b3Le1d1b3a2", "h0L", "d1d2b3Le1d1d6e5", "d2c3", "d1d2b3Le1d1c4d3", "h0g1", "d1d2b3Le1d1c4d4", "h0h1", "d1d2b3Ld2c1b3b2", "h0h1", "d1d2b3Ld2c1b3c2", "g4L", "d1d2b3Ld2c1c5d4", "g4L", "d1d2b3Ld2c1a7b7", "g4L", "d1d2b3Ld2c1b3a3", "g4L", "d1d2b3b2h0Lb2L", "h0h1", "d1d2b3b2h0Lb2b1", "d2c1", "d1d2b3b2h0Lb4R", "d2c3", "d1d2b3b2h0Lc4U", "d2c2", "d1d2b3b2h0Lc4d4", "e1L", "d1d2b3b2h0g1b2L", "g4L", "d1d2b3b2h0g1e6R", "g4L", "d1d2b3b2h0g1b4b3", "f3R", "d1d2b3b2h0g1c4d4", "g4L", "d1d2b3b2h0g1b4c3", "g4L", "d1d2b3b2d2c1b2L", "h0h1", "d1d2b3b2d2c1b2c1L", "g4L", "d1d2b3b2d2c1b2c1b1", "h0h1", "d1d2b3b2d2c1b2b3", "g4L", "d1d2b3b2d2c1c4R", "g4L", "d1d2b3b2d2c3b2L", "h0g1", "d1d2b3b2d2c3b2c3L", "h0g1", "d1d2b3b2d2c3b2b1", "h0L", "d1d2b3b2d2c3c4c3U", "g4L", "d1d2b3b2d2c3b4c3L", "b4c3R", "d1d2b3b2d2c2b2L", "h0g1", "d1d2b3b2d2c2b2c2L", "h0h1", "d1d2b3b2d2c2b2c2b3", "g4L", "d1d2b3b2d2c2b2c2b1", "h0g1", "d1d2b3b2d2c2e6R", "g4L", "d1d2c4d4g4Lb3L", "d2c3", "d1d2c4d4g4Ld4L", "g4h5", "d1d2c4d4g4Le6e5", "g4g5", "d1d2c4d4g4Ld4c4", "g4h5", "d1d2c4d4g4Le6f5", "g4f5g5", "d1d2c4d4g4g5b3L", "g5L", "d1d2c4d4g4g5d6e7", "g5L", "d1d2c4d4g4g5d6d7", "g5L", "d1d2c4d4g4g5e6f6", "g5L", "d1d2c4d4g4g5e6f5", "g5L", "d1d2c4d4h0g0b3L", "g4L", "d1d2c4d4h0g0b3b2", "d2c3", "d1d2c4d4h0g0b4R", "f3R", "d1d2c4d4h0g0e6e5", "f3e4", "d1d2c4d4h0g0a7b7", "g4L", "d1d2c4d4e2d3b3L", "g4L", "d1d2c4d4e2d3b3b2", "h0h1", "d1d2c4d4e2d3a7b7", "g4L", "d1d2c4d4e2d3b4L", "g4L", "d1d2c4d4e2d3d4e5", "g4L", "d1d2c4d4g3Lb3L", "g4L", "d1d2c4d4g3Lb3b2", "h0L", "d1d2c4d4g3Lb4R", "g4L", "d1d2c4d4g3Lb4L", "g4L", "d1d2c4d4g3Le6e5", "g4L", "d1d2b4Rg4Lb3L", "g4g5", "d1d2b4Rg4Ld6e7", "d2c3", "d1d2b4Rg4Ld6d7", "d2c3", "d1d2b4Rg4Ld5d4", "g4g5", "d1d2b4Rg4Ld6c7", "g4h4", "d1d2b4Rg4g5b3L", "g5L", "d1d2b4Rg4g5d6e7", "g5L", "d1d2b4Rg4g5d6d7", "g5L", "d1d2b4Rg4g5c4R", "g5L", "d1d2b4Rg4g5a7a6", "g5L", "d1d2b4Rg3Rb3L", "f3R", "d1d2b4Rg3Re6R", "g4U", "d1d2b4Rg3Rb3U", "g4L", "d1d2b4Rg3Rc4R", "g4L", "d1d2b4Rg3Rb3R", "g4L", "d1d2b4Rh0g0b3L", "g4L", "d1d2b4Rh0g0b3R", "g4L", "d1d2b4Rh0g0b3U", "g4L", "d1d2b4Rh0g0c4R", "g4L", "d1d2b4Rh0g0b4c3", "d2c3b4", "d1d2b4Rd2d3b3L", "d3c4b5", "d1d2b4Rd2d3b3U", "g4L", "d1d2b4Rd2d3b3R", "g4L", "d1d2b4Rd2d3d5d4", "g4L", "d1d2b4Rd2d3b4U", "g4L", "d1d2e6Rg4La7L", "d2R", "d1d2e6Rg4Ld6L", "g4h4", "d1d2e6Rg4La7a6", "d2c3", "d1d2e6Rg4Ld5L", "g4g5", "d1d2e6Rg4Lb3L", "g4g5", "d1d2e6Rd2d1e6f6", "g4L", "d1d2e6Rd2d1a7L", "g4L", "d1d2e6Rd2d1b3L", "g4L", "d1d2e6Rd2d1b3b2", "g4L", "d1d2e6Rd2d1d6R", "g4L", "d1d2e6Rd2c1a7L", "c1R", "d1d2e6Rd2c1e6f6", "g4L", "d1d2e6Rd2c1e6e7", "h0L", "d1d2e6Rd2c1d6R", "g4L", "d1d2e6Rd2c1a7a6", "h0L", "d1d2e6Rf3e4b3L", "g4L", "d1d2e6Rf3e4a7L", "h0g0", "d1d2e6Rf3e4b3b2", "h0g1", "d1d2e6Rf3e4e6e7", "e4d5e5", "d1d2e6Rf3e4e6f6", "g4L", "d1d2e6Rh0g0a7L", "d2R", "d1d2e6Rh0g0b3L", "d2c3", "d1d2e6Rh0g0e6e7", "d2R", "d1d2e6Rh0g0e6f6", "g4L", "d1d2e6Rh0g0d6L", "g4L", "e2d2b3Lg4Lb3b2", "g4g5", "e2d2b3Lg4Le6f6", "f3e3", "e2d2b3Lg4Lb3a3", "d2c2", "e2d2b3Lg4Ld6e7", "d1c2", "e2d2b3Lg4Lc4d4", "d1c2", "e2d2b3Le1d0b3a2", "g4L", "e2d2b3Le1d0c4d3", "d2d3e2", "e2d2b3Le1d0c5d4", "g4L", "e2d2b3Le1d0a7b6", "g4L", "e2d2b3Le1d0b3b2", "g4L", "e2d2b3Le1f0b3a2", "g4L", "e2d2b3Le1f0b3b2", "g4L", "e2d2b3Le1f0c4d3", "g4L", "e2d2b3Le1f0c5d4", "g4L", "e2d2b3Le1f0a7b6", "g4L", "e2d2b3Le1e0b3a2", "g4L", "e2d2b3Le1e0c4d3", "g4L", "e2d2b3Le1e0b3b2", "g4L", "e2d2b3Le1e0c5d4", "g4L", "e2d2b3Le1e0a7b6", "g4L", "e2d2b3Lh0h1b3a2", "g4L", "e2d2b3Lh0h1b3b2", "d1c2", "e2d2b3Lh0h1b4R", "g4L", "e2d2b3Lh0h1b3a3", "g4L", "e2d2b3Lh0h1c5d4", "g4L", "e2d2b3b2e1d0b2L", "g4L", "e2d2b3b2e1d0d6e5", "g4L", "e2d2b3b2e1d0c4d4", "g4L", "e2d2b3b2e1d0b4R", "g4L", "e2d2b3b2e1d0b2U", "g4L", "e2d2b3b2g4Lb2L", "g4g5", "e2d2b3b2g4Lb2b1", "e1d0", "e2d2b3b2g4La7a6", "g4h4", "e2d2b3b2g4Ld6e7", "d1c2", "e2d2b3b2g4Ld6d7", "d2c3", "e2d2b3b2e1e0b2L", "g4L", "e2d2b3b2e1e0c4d4", "g4L", "e2d2b3b2e1e0e6R", "g4L", "e2d2b3b2e1e0b2U", "g4L", "e2d2b3b2e1e0b2R", "g4L", "e2d2b3b2d1c1b2L", "h0L", "e2d2b3b2d1c1b2c1L", "g4L", "e2d2b3b2d1c1b2c1b1", "h0L", "e2d2b3b2d1c1b2b3", "g4L", "e2d2b3b2d1c1b4b3", "h0L", "e2d2b3b2e1f0b2L", "g4L", "e2d2b3b2e1f0c4d4", "g4L", "e2d2b3b2e1f0d6e5", "g4L", "e2d2b3b2e1f0b2b1", "g4L", "e2d2b3b2e1f0b4R", "g4L", "e2d2c4d4g4Lb3L", "d1c2", "e2d2c4d4g4Ld4L", "g4h5", "e2d2c4d4g4Le6e5", "e1L", "e2d2c4d4g4Ld4c4", "g4h5", "e2d2c4d4g4Le6f5", "g4f5g5", "e2d2c4d4h0g0b3L", "g4L", "e2d2c4d4h0g0b4R", "f2R", "e2d2c4d4h0g0e6e5", "d2R", "e2d2c4d4h0g0b3U", "g4L", "e2d2c4d4h0g0b3R", "g4L", "e2d2c4d4g3Rb3L", "g4L", "e2d2c4d4g3Rb3b2", "g4L", "e2d2c4d4g3Re6R", "g4L", "e2d2c4d4g3Rb4R", "g4L", "e2d2c4d4g3Rb4c3", "g4L", "e2d2c4d4g4g5b3L", "g5L", "e2d2c4d4g4g5d6e7", "g5L", "e2d2c4d4g4g5d6d7", "g5L", "e2d2c4d4g4g5a7a6", "g5L", "e2d2c4d4g4g5e6f6", "g5L", "e2d2c4d4e1e2b3L", "g4L", "e2d2c4d4e1e2b3b2", "d1R", "e2d2c4d4e1e2b4L", "g4L", "e2d2c4d4e1e2b4R", "g4L", "e2d2c4d4e1e2e6R", "g4L", "e2d2b4Rg4Lb3L", "g4g5", "e2d2b4Rg4Le6e7", "g4h4", "e2d2b4Rg4Ld6e7", "d2c3", "e2d2b4Rg4Ld6d7", "d2c3", "e2d2b4Rg4Ld6c7", "g4h4", "e2d2b4Rg4g5d6e7", "f3e3", "e2d2b4Rg4g5b3L", "g5L", "e2d2b4Rg4g5c4R", "g5L", "e2d2b4Rg4g5e6f6", "g5L", "e2d2b4Rg4g5e6R", "g5L", "e2d2b4Rd1Rb3L", "h0L", "e2d2b4Rd1Rb3U", "g4g5", "e2d2b4Rd1Rb3R", "g4L", "e2d2b4Rd1Re6R", "h0L", "e2d2b4Rd1Re6f6", "h0L", "e2d2b4Rh0Lb3L", "h0h1", "e2d2b4Rh0Lc4d3", "h0h1", "e2d2b4Rh0Lb3b2", "d1R", "e2d2b4Rh0Lc4c3", "h0R", "e2d2b4Rh0Le6R", "d1R", "e2d2b4Rh0g0b3L", "g4L", "e2d2b4Rh0g0b3U", "f2R", "e2d2b4Rh0g0b3R", "g4L", "e2d2b4Rh0g0c4d4", "g4L", "e2d2b4Rh0g0c4R", "g4L", "e2d2e6Rd2e2a7L", "g4L", "e2d2e6Rd2e2b3L", "g4L", "e2d2e6Rd2e2b3b2", "g4L", "e2d2e6Rd2e2e6f6", "g4L", "e2d2e6Rd2e2d6R", "g4L", "e2d2e6Rg4La7L", "d2e2", "e2d2e6Rg4Ld6L", "g4h4", "e2d2e6Rg4La7a6", "g4h4", "e2d2e6Rg4Lb3L", "g4g5", "e2d2e6Rg4Ld5L", "g4h5", "e2d2e6Re1f1a7L", "g4L", "e2d2e6Re1f1d6R", "g4L", "e2d2e6Re1f1d6L", "g4L", "e2d2e6Re1f1b3L", "g4L", "e2d2e6Re1f1c4d4", "g4L", "e2d2e6Rd1Ra7L", "h0L", "e2d2e6Rd1Re6f6", "g4L", "e2d2e6Rd1Rb3L", "h0L", "e2d2e6Rd1Rb3b2", "d1e0", "e2d2e6Rd1Rd6L", "d1c0", "e2d2e6Rh0La7L", "d1R", "e2d2e6Rh0Ld6L", "d1R", "e2d2e6Rh0Lb3L", "h0h1", "e2d2e6Rh0Lc5d4", "f2e2", "e2d2e6Rh0Lb3c3", "d1R", "d1Rb3Lh0Lb3a3", "e2L", "d1Rb3Lh0Lb4R", "d1d0", "d1Rb3Lh0Lb3b2", "d1d0", "d1Rb3Lh0Le6f6", "d1c1", "d1Rb3Lh0Lc4R", "e1L", "d1Rb3Ld1e0b3a3", "h0L", "d1Rb3Ld1e0c4R", "h0L", "d1Rb3Ld1e0b4c3", "h0L", "d1Rb3Ld1e0b3c2", "e0d0", "d1Rb3Ld1e0b3b2", "h0L", "d1Rb3Lh0h1b4c3", "h1L", "d1Rb3Lh0h1b3a3", "h1L", "d1Rb3Lh0h1b3b2", "h1L", "d1Rb3Lh0h1b4R", "h1L", "d1Rb3Lh0h1a7b7", "g4L", "d1Rb3Lh0g1b3a3", "g1L", "d1Rb3Lh0g1b4c3", "d1c1", "d1Rb3Lh0g1b3b2", "g1L", "d1Rb3Lh0g1b4L", "g1L", "d1Rb3Lh0g1b4R", "g1L", "d1Rb3Le1e0c4R", "g4L", "d1Rb3Le1e0b3a3", "g4L", "d1Rb3Le1e0b4c3", "g4L", "d1Rb3Le1e0b3a2", "h0L", "d1Rb3Le1e0c4d3", "h0L", "d1Rb3b2h0Lb2L", "d1d0", "d1Rb3b2h0La7b7", "d1d0", "d1Rb3b2h0Lb2U", "d1d0", "d1Rb3b2h0La7b6", "h0h1", "d1Rb3b2h0Lc4c3", "d1d0", "d1Rb3b2d1d0b2L", "h0L", "d1Rb3b2d1d0d6L", "h0L", "d1Rb3b2d1d0e6f6", "h0L", "d1Rb3b2d1d0b2b1", "h0L", "d1Rb3b2d1d0b4R", "h0L", "d1Rb3b2d1c0b2L", "h0L", "d1Rb3b2d1c0b4a3", "g4L", "d1Rb3b2d1c0b2c1", "c0c1d1", "d1Rb3b2d1c0b2b1", "h0L", "d1Rb3b2d1c0a7b7", "c0d0", "d1Rb3b2e1d0b2L", "h0L", "d1Rb3b2e1d0b4R", "h0L", "d1Rb3b2e1d0b4L", "g4L", "d1Rb3b2e1d0b4U", "g4L", "d1Rb3b2e1d0c5L", "g4L", "d1Rb3b2d1e0b2L", "h0L", "d1Rb3b2d1e0b2b1", "h0L", "d1Rb3b2d1e0b4R", "h0L", "d1Rb3b2d1e0c5L", "e0d0", "d1Rb3b2d1e0c5U", "h0L", "d1Rb4Lh0Lb3L", "e2L", "d1Rb4Lh0Lb3U", "d1c0", "d1Rb4Lh0Lb4R", "d1c0", "d1Rb4Lh0La7L", "d1c1", "d1Rb4Lh0Lb4U", "d1c0", "d1Rb4Ld1c1b3L", "h0L", "d1Rb4Ld1c1b3U", "h0L", "d1Rb4Ld1c1b3b2", "c1b2a1", "d1Rb4Ld1c1b4U", "h0L", "d1Rb4Ld1c1b4R", "g4L", "d1Rb4Ld1d0b3L", "h0L", "d1Rb4Ld1d0c4c3", "h0L", "d1Rb4Ld1d0e6f6", "h0L", "d1Rb4Ld1d0e6R", "h0L", "d1Rb4Ld1d0a7L", "h0L", "d1Rb4Lg4Lb3L", "g4g5", "d1Rb4Lg4Ld6e7", "d1c2", "d1Rb4Lg4Ld6d7", "g4h4", "d1Rb4Lg4Ld6c7", "f2e3", "d1Rb4Lg4La7a6", "g4h4", "d1Rb4Lg4g5b3L", "g5L", "d1Rb4Lg4g5d6e7", "h0L", "d1Rb4Lg4g5d6d7", "h0L", "d1Rb4Lg4g5e6f6", "g5L", "d1Rb4Lg4g5d6c7", "h0L", "d1Rb4Rh0Lb3L", "d1d0", "d1Rb4Rh0Lb3U", "d1d0", "d1Rb4Rh0Lb3b2", "e1L", "d1Rb4Rh0Ld5R", "e2L", "d1Rb4Rh0Lb3c2", "e2L", "d1Rb4Rg4Lb3L", "h0L", "d1Rb4Rg4Le6f6", "g3f4", "d1Rb4Rg4Lb3b2", "d1c2", "d1Rb4Rg4Lb3R", "g4g5", "d1Rb4Rg4Ld6e7", "h0L", "d1Rb4Rg4g5b3L", "d1d0", "d1Rb4Rg4g5d6e7", "h0L", "d1Rb4Rg4g5d6c7", "d1d0", "d1Rb4Rg4g5d6d7", "h0L", "d1Rb4Rg4g5e6f6", "g5L", "d1Rb4Re1Rb3L", "h0L", "d1Rb4Re1Rb3U", "g4L", "d1Rb4Re1Rb3R", "g4L", "d1Rb4Re1Rb4U", "g4L", "d1Rb4Re1Rb4c3", "h0L", "d1Rb4Re1Lb3b2", "h0L", "d1Rb4Re1Lb3L", "h0L", "d1Rb4Re1Lb3U", "g4g5", "d1Rb4Re1Lb4U", "g4L", "d1Rb4Re1Lb4c3", "h0L", "d1Ra7b7h0Lc4d3", "h0h1", "d1Ra7b7h0Lb3L", "e2L", "d1Ra7b7h0Lc4c3", "e2L", "d1Ra7b7h0Lb3b2", "h0h1", "d1Ra7b7h0Lb3c3", "d1c0", "d1Ra7b7e1Rb3L", "g4L", "d1Ra7b7e1Rc5R", "g4L", "d1Ra7b7e1Rc4R", "g4L", "d1Ra7b7e1Rc5b5", "h0L", "d1Ra7b7e1Rb3U", "g4L", "d1Ra7b7d1c1b3L", "h0L", "d1Ra7b7d1c1b3c2", "g4L", "d1Ra7b7d1c1b3b2", "g4L", "d1Ra7b7d1c1b3a4", "g4L", "d1Ra7b7d1c1b3a2", "g4L", "d1Ra7b7e1Lb3L", "h0L", "d1Ra7b7e1Lc4R", "h0L", "d1Ra7b7e1Lc4c3", "g4L", "d1Ra7b7e1Lc5R", "h0L", "d1Ra7b7e1Lb3b2", "e2d2", "d1Ra7b7e1Ub3L", "g4g5", "d1Ra7b7e1Uc4R", "g4L", "d1Ra7b7e1Uc5R", "g4L", "d1Ra7b7e1Uc4c3", "g4L", "d1Ra7b7e1Uc5b5", "g4L"};
-
-
-
-char** lookup_tables[OPEN_BOOK_DEPTH] = {
-    lookup_table_depth_1,
-    lookup_table_depth_2,
-    lookup_table_depth_3,
-    lookup_table_depth_4,
-    lookup_table_depth_5,
-    lookup_table_depth_6
-};
-
-#endif // LOOKUP_H
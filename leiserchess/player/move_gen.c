@@ -6,14 +6,18 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
+#include <cilk/cilk.h>
+
 #include "./eval.h"
 #include "./fen.h"
 #include "./search.h"
 #include "./tbassert.h"
+#include "./tt.h"
 #include "./util.h"
 
 
@@ -156,7 +160,8 @@ char* nesw_to_str[NUM_ORI] = {"north", "east", "south", "west"};
 //
 // https://www.chessprogramming.org/Zobrist_Hashing 
 //
-// NOTE: Zobrist hashing uses piece_t as an integer index into to the zob table.
+// NOTE: Zobrist hashing uses the low PIECE_SIZE bits of piece_t as an integer
+// index into to the zob table.
 // So if you change your piece representation, you'll need to recompute what the
 // old piece representation is when indexing into the zob table to get the same
 // node counts.
@@ -164,13 +169,21 @@ static uint64_t   zob[ARR_SIZE][1 << PIECE_SIZE];
 static uint64_t   zob_color;
 uint64_t myrand();
 
+// The piece index bits above PIECE_SIZE only tell the piece lists apart and
+// are not part of the position, so they are left out of the key.  (Indexing
+// zob with them would also reach into the rows of other squares, and give
+// different boards the same key.)
+static inline uint64_t zob_of(square_t sq, piece_t piece) {
+  return zob[sq][piece & ((1 << PIECE_SIZE) - 1)];
+}
+
 uint64_t compute_zob_key(position_t* p) {
   uint64_t key = 0;
   for (fil_t f = 0; f < BOARD_WIDTH; f++) {
     for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
       square_t sq = square_of(f, r);
       piece_t piece = p->board[sq];
-      key ^= zob[sq][piece];
+      key ^= zob_of(sq, piece);
     }
   }
   if (color_to_move_of(p) == BLACK) {
@@ -189,6 +202,16 @@ void init_zob() {
   zob_color = myrand();
 }
 
+void save_zob(zobKeys_t* keys) {
+  memcpy(keys->zob, zob, sizeof(zob));
+  keys->zob_color = zob_color;
+}
+
+void restore_zob(const zobKeys_t* keys) {
+  memcpy(zob, keys->zob, sizeof(zob));
+  zob_color = keys->zob_color;
+}
+
 // -----------------------------------------------------------------------------
 // Squares
 // -----------------------------------------------------------------------------
@@ -228,6 +251,110 @@ int square_to_str(square_t sq, char* buf, size_t bufsize) {
   }
 }
 
+// -----------------------------------------------------------------------------
+// Bitboards
+// -----------------------------------------------------------------------------
+
+int8_t bb_index_of_square[ARR_SIZE];
+square_t square_of_bb_index[NUM_BB_SQUARES];
+
+// The (up to) eight squares adjacent to each square
+static bitboard_t neighbors_bb[NUM_BB_SQUARES];
+
+bitboard_t laser_ray_bb[NUM_BB_SQUARES][NUM_ORI];
+
+void init_bitboards() {
+  for (int i = 0; i < ARR_SIZE; i++) {
+    bb_index_of_square[i] = -1;
+  }
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      int i = f * BOARD_WIDTH + r;
+      bb_index_of_square[square_of(f, r)] = i;
+      square_of_bb_index[i] = square_of(f, r);
+    }
+  }
+  for (int i = 0; i < NUM_BB_SQUARES; i++) {
+    neighbors_bb[i] = 0;
+    for (int df = -1; df <= 1; df++) {
+      for (int dr = -1; dr <= 1; dr++) {
+        int f = i / BOARD_WIDTH + df;
+        int r = i % BOARD_WIDTH + dr;
+        if ((df != 0 || dr != 0) && f >= 0 && f < BOARD_WIDTH &&
+            r >= 0 && r < BOARD_WIDTH) {
+          neighbors_bb[i] |= 1ULL << (f * BOARD_WIDTH + r);
+        }
+      }
+    }
+  }
+  for (int i = 0; i < NUM_BB_SQUARES; i++) {
+    for (int bdir = 0; bdir < NUM_ORI; bdir++) {
+      laser_ray_bb[i][bdir] = 0;
+      square_t sq = square_of_bb_index[i] + beam_of(bdir);
+      while (bb_index_of_square[sq] >= 0) {
+        laser_ray_bb[i][bdir] |= bb_of_square(sq);
+        sq += beam_of(bdir);
+      }
+    }
+  }
+}
+
+// Flips piece x on sq in the bitboards of p: adds it if it was not there and
+// removes it if it was.  Empty squares are ignored.
+static inline void toggle_bitboards(position_t* p, square_t sq, piece_t x) {
+  ptype_t typ = ptype_of(x);
+  if (typ == PAWN || typ == KING) {
+    bitboard_t b = bb_of_square(sq);
+    p->bb_color[color_of(x)] ^= b;
+    p->bb_ptype[typ - PAWN] ^= b;
+    p->bb_ori[ori_of(x)] ^= b;
+  }
+}
+
+// Toggles whatever currently stands on the distinct squares of a move.
+static inline void toggle_move_squares(position_t* p, square_t from_sq,
+                                       square_t int_sq, square_t to_sq) {
+  toggle_bitboards(p, from_sq, p->board[from_sq]);
+  if (int_sq != from_sq) {
+    toggle_bitboards(p, int_sq, p->board[int_sq]);
+  }
+  if (to_sq != int_sq && to_sq != from_sq) {
+    toggle_bitboards(p, to_sq, p->board[to_sq]);
+  }
+}
+
+// Builds the bitboards of p from scratch out of p->board.
+void compute_bitboards(position_t* p) {
+  p->bb_color[WHITE] = p->bb_color[BLACK] = 0;
+  p->bb_ptype[0] = p->bb_ptype[1] = 0;
+  for (int ori = 0; ori < NUM_ORI; ori++) {
+    p->bb_ori[ori] = 0;
+  }
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      square_t sq = square_of(f, r);
+      toggle_bitboards(p, sq, p->board[sq]);
+    }
+  }
+}
+
+// True if the incrementally maintained bitboards of p agree with p->board.
+bool bitboards_ok(position_t* p) {
+  position_t q;
+  for (int i = 0; i < ARR_SIZE; i++) {
+    q.board[i] = p->board[i];
+  }
+  compute_bitboards(&q);
+  bool ok = q.bb_color[WHITE] == p->bb_color[WHITE] &&
+            q.bb_color[BLACK] == p->bb_color[BLACK] &&
+            q.bb_ptype[0] == p->bb_ptype[0] &&
+            q.bb_ptype[1] == p->bb_ptype[1];
+  for (int ori = 0; ori < NUM_ORI; ori++) {
+    ok = ok && q.bb_ori[ori] == p->bb_ori[ori];
+  }
+  return ok;
+}
+
 // -----------------------------------------------------------------------------
 // Board direction and laser direction
 // -----------------------------------------------------------------------------
@@ -347,112 +474,53 @@ int generate_all(position_t* p, sortable_move_t* sortable_move_list,
   color_t color = color_to_move;
   int move_count = 0;
 
-  square_t* pieces_of_color = p->pieceLocations[color];  
+  // Neighbours are visited in increasing bit order, which is also the order
+  // of dir_of(), so the moves come out in the same order as a mailbox scan.
+  bitboard_t own = p->bb_color[color];
+  bitboard_t opp = p->bb_color[opp_color(color)];
+  bitboard_t empty = ~(own | opp);
+
+  square_t* pieces_of_color = p->pieceLocations[color];
   for (int i = 0; i < NUM_PIECES_SIDE; i++) {
     square_t sq = pieces_of_color[i];
-    if (sq != -1) {
-      piece_t x = p->board[sq];
-
-      ptype_t typ = ptype_of(x);
-
-      // switch (typ) {
-      // case EMPTY:
-      //   printf("SHOULD NEVER GET HERE IN GEN: Location from pieceLocations was empty");
-      //   break;
-      // case PAWN:
-      // case KING:
-      //   if (color != color_to_move) {  // Wrong color.
-      //     printf("SHOULD NEVER GET HERE IN GEN: Location from pieceLocations was empty");
-      //     break;
-      //   }
-      // directions
-      for (int d = 0; d < 8; d++) {
-        bool is_swap = false;
-        int dest = sq + dir_of(d);
-        switch(ptype_of(p->board[dest])) {
-          case INVALID:
-            // Skip moves into invalid squares
-            continue;
-            break;
-          case EMPTY:
-            break;
-          case PAWN:
-          case KING:
-            if(color_of(p->board[dest]) == color){
-              // Check that we are not swapping with a friendly piece
-              continue;
-            } else {
-              is_swap = true;
-              break;
-            }
-          default:
-            tbassert(false, "Very unfortunate");
-            break; // Bad!
-        }
-        // if (ptype_of(p->board[dest]) != EMPTY && color_of(p->board[dest]) != color) {
-        //   // The destination square contains a piece of the opposite color
-        //   is_swap = true;
-        // }
-
-        if(!is_swap){
-          WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
-          WHEN_DEBUG_VERBOSE({
-            move_to_str(move_of(typ, (rot_t) 0, sq, (square_t) sq, dest), buf, MAX_CHARS_IN_MOVE);
-            DEBUG_LOG(1, "Before: %s ", buf);
-          });
-          tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-          sortable_move_list[move_count++] = move_of(typ, (rot_t) 0, sq, sq, dest);
-
-          WHEN_DEBUG_VERBOSE({
-            move_to_str(get_move(sortable_move_list[move_count - 1]), buf, MAX_CHARS_IN_MOVE);
-            DEBUG_LOG(1, "After: %s\n", buf);
-          });
-        }
+    if (sq == -1) {
+      continue;
+    }
+    ptype_t typ = ptype_of(p->board[sq]);
+    tbassert(typ == PAWN || typ == KING, "typ: %d\n", typ);
 
-        // Consider double moves
-        if(is_swap) {
-          for (int d = 0; d < 8; d++) {
-            int final_dest = dest + dir_of(d);
-            ptype_t final_type = ptype_of(p->board[final_dest]);
-            if(final_dest == sq) {
-              continue; // Do not generate a null move
-            }
-            if (final_type != EMPTY) {
-              continue; // Cannot do a double swap
-            }
-
-            WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
-            WHEN_DEBUG_VERBOSE({
-              move_to_str(move_of(typ, (rot_t) 0, sq, dest, final_dest), buf, MAX_CHARS_IN_MOVE);
-              DEBUG_LOG(1, "Before: %s ", buf);
-            });
-            tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-            sortable_move_list[move_count++] = move_of(typ, (rot_t) 0, sq, dest, final_dest);
-
-            WHEN_DEBUG_VERBOSE({
-              move_to_str(get_move(sortable_move_list[move_count - 1]), buf, MAX_CHARS_IN_MOVE);
-              DEBUG_LOG(1, "After: %s\n", buf);
-            });
-          }
+    // Moves and swaps: any neighbour not held by a friendly piece
+    bitboard_t targets = neighbors_bb[bb_index_of_square[sq]] & ~own;
+    while (targets) {
+      bitboard_t dest_bb = targets & -targets;
+      square_t dest = bb_pop_square(&targets);
 
-          // swap-rotates
-          for (int rot = 1; rot < 4; ++rot) {
-            tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-            sortable_move_list[move_count++] = move_of(typ, (rot_t) rot, sq, dest, dest);
-          }
-        }
+      if (!(dest_bb & opp)) {
+        tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+        sortable_move_list[move_count++] = move_of(typ, (rot_t) 0, sq, sq, dest);
+        continue;
       }
 
-      // rotations - three directions possible
+      // Double moves: swap onto dest, then step to an empty square.  sq is
+      // never empty, so the null move is excluded.
+      bitboard_t finals = neighbors_bb[bb_index_of_square[dest]] & empty;
+      while (finals) {
+        square_t final_dest = bb_pop_square(&finals);
+        tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+        sortable_move_list[move_count++] = move_of(typ, (rot_t) 0, sq, dest, final_dest);
+      }
+
+      // swap-rotates
       for (int rot = 1; rot < 4; ++rot) {
         tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-        sortable_move_list[move_count++] = move_of(typ, (rot_t) rot, sq, sq, sq);
+        sortable_move_list[move_count++] = move_of(typ, (rot_t) rot, sq, dest, dest);
       }
-      //   break;
-      // case INVALID:
-      // default:
-      //   tbassert(false, "Bogus, man.\n");  // Couldn't BE more bogus!
-      // }
+    }
+
+    // rotations - three directions possible
+    for (int rot = 1; rot < 4; ++rot) {
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count++] = move_of(typ, (rot_t) rot, sq, sq, sq);
     }
   }
 
@@ -469,6 +537,51 @@ int generate_all(position_t* p, sortable_move_t* sortable_move_list,
   return move_count;
 }
 
+// Returns true if generate_all(p) would generate mv.  Used to vet moves
+// remembered from other positions (hash moves and killers) before trying them
+// without generating the full move list.
+bool is_pseudo_legal(position_t* p, move_t mv) {
+  square_t from_sq = from_square(mv);
+  square_t int_sq = intermediate_square(mv);
+  square_t to_sq = to_square(mv);
+  rot_t rot = rot_of(mv);
+
+  if (from_sq >= ARR_SIZE || int_sq >= ARR_SIZE || to_sq >= ARR_SIZE ||
+      bb_index_of_square[from_sq] < 0 || bb_index_of_square[int_sq] < 0 ||
+      bb_index_of_square[to_sq] < 0) {
+    return false;
+  }
+
+  color_t color = color_to_move_of(p);
+  piece_t x = p->board[from_sq];
+  if (!(p->bb_color[color] & bb_of_square(from_sq)) ||
+      ptype_of(x) != ptype_mv_of(mv)) {
+    return false;
+  }
+
+  bitboard_t empty = ~(p->bb_color[WHITE] | p->bb_color[BLACK]);
+  bitboard_t from_nbrs = neighbors_bb[bb_index_of_square[from_sq]];
+
+  if (int_sq == from_sq) {
+    if (to_sq == from_sq) {  // rotation
+      return rot != NONE;
+    }
+    // plain move to an empty neighbour
+    return rot == NONE && (from_nbrs & empty & bb_of_square(to_sq));
+  }
+
+  // swap with an opposing neighbour ...
+  if (!(from_nbrs & p->bb_color[opp_color(color)] & bb_of_square(int_sq))) {
+    return false;
+  }
+  if (to_sq == int_sq) {  // ... then rotate
+    return rot != NONE;
+  }
+  // ... then move on to an empty square
+  return rot == NONE &&
+         (neighbors_bb[bb_index_of_square[int_sq]] & empty & bb_of_square(to_sq));
+}
+
 int generate_all_with_color(position_t* p, sortable_move_t* sortable_move_list, 
                  color_t color) {
   color_t color_to_move = color_to_move_of(p);
@@ -493,10 +606,13 @@ int generate_all_with_color(position_t* p, sortable_move_t* sortable_move_list,
 // Returns the square of piece that would be zapped by the laser if fired once,
 // or 0 if no such piece exists.
 //
+// The beam jumps from piece to piece with laser_first_blocker() rather than
+// stepping over the empty squares in between.
+//
 // p : Current board state.
 // c : Color of king shooting laser.
 square_t fire_laser(position_t* p, color_t c) {
-  // color_t fake_color_to_move = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;0
+  bitboard_t occupied = p->bb_color[WHITE] | p->bb_color[BLACK];
   square_t sq = p->kloc[c];
   int bdir = ori_of(p->board[sq]);
 
@@ -504,86 +620,54 @@ square_t fire_laser(position_t* p, color_t c) {
            "ptype: %d\n", ptype_of(p->board[sq]));
 
   while (true) {
-    sq += beam_of(bdir);
-    tbassert(sq < ARR_SIZE && sq >= 0, "sq: %d\n", sq);
-
-    switch (ptype_of(p->board[sq])) {
-    case EMPTY:  // empty square
-      break;
-    case PAWN:  // Pawn
-      bdir = reflect_of(bdir, ori_of(p->board[sq]));
-      if (bdir < 0) {  // Hit back of Pawn
-        return sq;
-      }
-      break;
-    case KING:  // King
-      return sq;  // sorry, game over my friend!
-      break;
-    case INVALID:  // Ran off edge of board
+    sq = laser_first_blocker(occupied, sq, bdir);
+    if (sq == 0) {  // Ran off edge of board
       return 0;
-      break;
-    default:  // Shouldna happen, man!
-      tbassert(false, "Like porkchops and whipped cream.\n");
-      break;
+    }
+    piece_t x = p->board[sq];
+    if (ptype_of(x) == KING) {
+      return sq;  // sorry, game over my friend!
+    }
+    tbassert(ptype_of(x) == PAWN, "ptype: %d\n", ptype_of(x));
+    bdir = reflect_of(bdir, ori_of(x));
+    if (bdir < 0) {  // Hit back of Pawn
+      return sq;
     }
   }
 }
 
-void low_level_make_move(position_t* old, position_t* p, move_t mv) {
-  tbassert(mv != 0, "mv was zero.\n");
-
-  WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
-  WHEN_DEBUG_VERBOSE({
-    move_to_str(mv, buf, MAX_CHARS_IN_MOVE);
-    DEBUG_LOG(1, "low_level_make_move: %s\n", buf);
-  });
+// Returns the on-board squares the laser of color c passes through, including
+// the king itself and the piece (if any) where the beam stops.
+bitboard_t laser_path_bb(position_t* p, color_t c) {
+  bitboard_t occupied = p->bb_color[WHITE] | p->bb_color[BLACK];
+  square_t sq = p->kloc[c];
+  int bdir = ori_of(p->board[sq]);
+  bitboard_t path = bb_of_square(sq);
 
-  tbassert(old->key == compute_zob_key(old),
-           "old->key: %"PRIu64", zob-key: %"PRIu64"\n",
-           old->key, compute_zob_key(old));
+  tbassert(ptype_of(p->board[sq]) == KING,
+           "ptype: %d\n", ptype_of(p->board[sq]));
 
-  WHEN_DEBUG_VERBOSE({
-    fprintf(stderr, "Before:\n");
-    display(old);
-  });
+  while (true) {
+    square_t blocker = laser_first_blocker(occupied, sq, bdir);
+    path |= laser_segment_bb(sq, bdir, blocker);
+    if (blocker == 0 || ptype_of(p->board[blocker]) == KING) {
+      return path;
+    }
+    bdir = reflect_of(bdir, ori_of(p->board[blocker]));
+    if (bdir < 0) {
+      return path;
+    }
+    sq = blocker;
+  }
+}
 
+// Moves the pieces of mv on p in place (phase 1 of a move: no laser).
+static void apply_move(position_t* p, move_t mv) {
   square_t from_sq = from_square(mv);
   square_t int_sq = intermediate_square(mv);
   square_t to_sq = to_square(mv);
   rot_t rot = rot_of(mv);
 
-  WHEN_DEBUG_VERBOSE({
-    DEBUG_LOG(1, "low_level_make_move 2:\n");
-    square_to_str(from_sq, buf, MAX_CHARS_IN_MOVE);
-    DEBUG_LOG(1, "from_sq: %s\n", buf);
-    square_to_str(int_sq, buf, MAX_CHARS_IN_MOVE);
-    DEBUG_LOG(1, "int_sq: %s\n", buf);
-    square_to_str(to_sq, buf, MAX_CHARS_IN_MOVE);
-    DEBUG_LOG(1, "to_sq: %s\n", buf);
-    switch (rot) {
-    case NONE:
-      DEBUG_LOG(1, "rot: none\n");
-      break;
-    case RIGHT:
-      DEBUG_LOG(1, "rot: R\n");
-      break;
-    case UTURN:
-      DEBUG_LOG(1, "rot: U\n");
-      break;
-    case LEFT:
-      DEBUG_LOG(1, "rot: L\n");
-      break;
-    default:
-      tbassert(false, "Not like a boss at all.\n");  // Bad, bad, bad
-      break;
-    }
-  });
-
-  *p = *old;
-
-  p->history = old;
-  p->last_move = mv;
-
   tbassert(from_sq < ARR_SIZE && from_sq > 0, "from_sq: %d\n", from_sq);
   // tbassert(p->board[from_sq] < (1 << PIECE_SIZE) && p->board[from_sq] >= 0,
   //          "p->board[from_sq]: %d\n", p->board[from_sq]);
@@ -599,11 +683,12 @@ void low_level_make_move(position_t* old, position_t* p, move_t mv) {
   bool is_double_move = false;
 
   update_piececentric(p, mv);
+  toggle_move_squares(p, from_sq, int_sq, to_sq);  // take the pieces off
 
   if (to_sq != from_sq) {  // move, not rotation
     // Hash key updates
-    p->key ^= zob[from_sq][from_piece];  // remove from_piece from from_sq
-    p->key ^= zob[to_sq][to_piece];  // remove to_piece from to_sq
+    p->key ^= zob_of(from_sq, from_piece);  // remove from_piece from from_sq
+    p->key ^= zob_of(to_sq, to_piece);  // remove to_piece from to_sq
     if(int_sq != from_sq){
       // This is a double move
       is_double_move = true;
@@ -612,31 +697,31 @@ void low_level_make_move(position_t* old, position_t* p, move_t mv) {
       p->board[int_sq] = from_piece;
 
       if(int_sq != to_sq){
-        p->key ^= zob[int_sq][int_piece];  // remove int_piece from int_sq
+        p->key ^= zob_of(int_sq, int_piece);  // remove int_piece from int_sq
         // Either a swap-move or a swap-swap
         p->board[int_sq] = to_piece;  // Pieces should move the order from->to, to->int, int->from
         p->board[to_sq] = from_piece;
 
-        p->key ^= zob[int_sq][to_piece];   // place to_piece in int_sq
-        p->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
-        p->key ^= zob[from_sq][int_piece]; // place int_piece in from_sq
+        p->key ^= zob_of(int_sq, to_piece);   // place to_piece in int_sq
+        p->key ^= zob_of(to_sq, from_piece);  // place from_piece in to_sq
+        p->key ^= zob_of(from_sq, int_piece); // place int_piece in from_sq
       } else {
         // A swap-rotate
         // Swap
-        p->key ^= zob[from_sq][int_piece]; // Place int_piece in from_sq
-        p->key ^= zob[int_sq][from_piece]; // Place from_piece in int_sq
+        p->key ^= zob_of(from_sq, int_piece); // Place int_piece in from_sq
+        p->key ^= zob_of(int_sq, from_piece); // Place from_piece in int_sq
         // And rotate
-        p->key ^= zob[int_sq][from_piece];
+        p->key ^= zob_of(int_sq, from_piece);
         set_ori(&from_piece, rot + ori_of(from_piece));  // rotate from_piece
         p->board[int_sq] = from_piece;  // place rotated piece on board
-        p->key ^= zob[int_sq][from_piece];              // ... and in hash
+        p->key ^= zob_of(int_sq, from_piece);              // ... and in hash
       }
     } else {
       p->board[to_sq] = from_piece;  // swap from_piece and to_piece on board
       p->board[from_sq] = to_piece;
 
-      p->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
-      p->key ^= zob[from_sq][to_piece];  // place to_piece in from_sq
+      p->key ^= zob_of(to_sq, from_piece);  // place from_piece in to_sq
+      p->key ^= zob_of(from_sq, to_piece);  // place to_piece in from_sq
     }
 
     // Update King locations if necessary
@@ -658,17 +743,78 @@ void low_level_make_move(position_t* old, position_t* p, move_t mv) {
 
   } else {  // rotation
     // remove from_piece from from_sq in hash
-    p->key ^= zob[from_sq][from_piece];
+    p->key ^= zob_of(from_sq, from_piece);
     set_ori(&from_piece, rot + ori_of(from_piece));  // rotate from_piece
     p->board[from_sq] = from_piece;  // place rotated piece on board
-    p->key ^= zob[from_sq][from_piece];              // ... and in hash
+    p->key ^= zob_of(from_sq, from_piece);              // ... and in hash
   }
 
+  toggle_move_squares(p, from_sq, int_sq, to_sq);  // ... and put them back
+
   // Increment ply
   p->ply++;
   tbassert(p->key == compute_zob_key(p),
            "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
            p->key, compute_zob_key(p));
+  tbassert(bitboards_ok(p), "bitboards out of sync\n");
+
+}
+
+void low_level_make_move(position_t* old, position_t* p, move_t mv) {
+  tbassert(mv != 0, "mv was zero.\n");
+
+  WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
+  WHEN_DEBUG_VERBOSE({
+    move_to_str(mv, buf, MAX_CHARS_IN_MOVE);
+    DEBUG_LOG(1, "low_level_make_move: %s\n", buf);
+  });
+
+  tbassert(old->key == compute_zob_key(old),
+           "old->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           old->key, compute_zob_key(old));
+
+  WHEN_DEBUG_VERBOSE({
+    fprintf(stderr, "Before:\n");
+    display(old);
+  });
+
+  WHEN_DEBUG_VERBOSE({
+    square_t from_sq = from_square(mv);
+    square_t int_sq = intermediate_square(mv);
+    square_t to_sq = to_square(mv);
+    rot_t rot = rot_of(mv);
+    DEBUG_LOG(1, "low_level_make_move 2:\n");
+    square_to_str(from_sq, buf, MAX_CHARS_IN_MOVE);
+    DEBUG_LOG(1, "from_sq: %s\n", buf);
+    square_to_str(int_sq, buf, MAX_CHARS_IN_MOVE);
+    DEBUG_LOG(1, "int_sq: %s\n", buf);
+    square_to_str(to_sq, buf, MAX_CHARS_IN_MOVE);
+    DEBUG_LOG(1, "to_sq: %s\n", buf);
+    switch (rot) {
+    case NONE:
+      DEBUG_LOG(1, "rot: none\n");
+      break;
+    case RIGHT:
+      DEBUG_LOG(1, "rot: R\n");
+      break;
+    case UTURN:
+      DEBUG_LOG(1, "rot: U\n");
+      break;
+    case LEFT:
+      DEBUG_LOG(1, "rot: L\n");
+      break;
+    default:
+      tbassert(false, "Not like a boss at all.\n");  // Bad, bad, bad
+      break;
+    }
+  });
+
+  *p = *old;
+
+  p->history = old;
+  p->last_move = mv;
+
+  apply_move(p, mv);
 
   WHEN_DEBUG_VERBOSE({
     fprintf(stderr, "After:\n");
@@ -676,6 +822,22 @@ void low_level_make_move(position_t* old, position_t* p, move_t mv) {
   });
 }
 
+// Removes the piece on victim_sq from p and records it as the victim.
+static void zap_piece(position_t* p, square_t victim_sq) {
+  piece_t victim_piece = p->board[victim_sq];
+  tbassert((ptype_of(victim_piece) != EMPTY) &&
+           (ptype_of(victim_piece) != INVALID),
+           "type: %d\n", ptype_of(victim_piece));
+
+  remove_piece(p, victim_sq);
+  toggle_bitboards(p, victim_sq, victim_piece);
+  p->victims.zapped_count++;
+  p->victims.zapped = victim_piece;
+  p->key ^= zob_of(victim_sq, victim_piece);   // remove from board
+  p->board[victim_sq] = 0;
+  p->key ^= zob_of(victim_sq, 0);
+}
+
 // return victim pieces or KO
 victims_t make_move(position_t* old, position_t* p, move_t mv) {
   tbassert(mv != 0, "mv was zero.\n");
@@ -685,6 +847,10 @@ victims_t make_move(position_t* old, position_t* p, move_t mv) {
   // move phase 1 - moving a piece
   low_level_make_move(old, p, mv);
 
+  // The key is final unless the laser zaps something, so get the child's
+  // transposition table set on its way while we fire the laser.
+  tt_prefetch(p->key);
+
   // move phase 2 - shooting the laser
   square_t victim_sq = 0;
   p->victims.zapped_count = 0;
@@ -696,13 +862,8 @@ victims_t make_move(position_t* old, position_t* p, move_t mv) {
     });
 
     // we definitely hit something with laser, remove it from board
-    remove_piece(p, victim_sq);
-    piece_t victim_piece = p->board[victim_sq];
-    p->victims.zapped_count++;
-    p->victims.zapped = victim_piece;
-    p->key ^= zob[victim_sq][victim_piece];
-    p->board[victim_sq] = 0;
-    p->key ^= zob[victim_sq][0];
+    zap_piece(p, victim_sq);
+    tt_prefetch(p->key);
     tbassert(p->key == compute_zob_key(p),
              "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
              p->key, compute_zob_key(p));
@@ -752,16 +913,206 @@ victims_t make_move(position_t* old, position_t* p, move_t mv) {
   return p->victims;
 }
 
+// -----------------------------------------------------------------------------
+// In-place move execution
+// -----------------------------------------------------------------------------
+
+// make_move() copies the whole position for every child.  When the caller
+// owns the position and visits the children one at a time, it can instead
+// move on the position itself and take the move back afterwards; undo_t
+// holds everything that a move can change.
+
+// Phase 1 of a move (no laser), in place.
+void low_level_do_move(position_t* p, move_t mv, undo_t* undo) {
+  tbassert(mv != 0, "mv was zero.\n");
+
+  undo->key = p->key;
+  undo->last_move = p->last_move;
+  undo->victims = p->victims;
+  undo->kloc[WHITE] = p->kloc[WHITE];
+  undo->kloc[BLACK] = p->kloc[BLACK];
+  undo->from_piece = p->board[from_square(mv)];
+  undo->int_piece = p->board[intermediate_square(mv)];
+  undo->to_piece = p->board[to_square(mv)];
+  undo->victim_sq = 0;
+
+  p->last_move = mv;
+  apply_move(p, mv);
+}
+
+// Both phases of a move, in place.  Unlike make_move(), this does not check
+// the Ko rule: the caller does, with is_ko_done().
+victims_t do_move(position_t* p, move_t mv, undo_t* undo) {
+  color_t color_to_move = color_to_move_of(p);
+  low_level_do_move(p, mv, undo);
+
+  square_t victim_sq = 0;
+  p->victims.zapped_count = 0;
+
+  if ((victim_sq = fire_laser(p, color_to_move))) {
+    undo->victim_sq = victim_sq;
+    undo->victim_piece = p->board[victim_sq];
+    zap_piece(p, victim_sq);
+  }
+  return p->victims;
+}
+
+// The Ko rule of make_move() for mv, just done on p in place with undo: the
+// move must change the board, and must not bring back the position before the
+// opponent's last move, whose key is prev_key.  The positions before p are
+// gone, so that one is recognized by its key alone.
+bool is_ko_done(position_t* p, move_t mv, undo_t* undo, uint64_t prev_key) {
+  if (!USE_KO) {
+    return false;
+  }
+  // Only the move's squares change unless the laser zaps something.
+  if (undo->victim_sq == 0 &&
+      p->board[from_square(mv)] == undo->from_piece &&
+      p->board[intermediate_square(mv)] == undo->int_piece &&
+      p->board[to_square(mv)] == undo->to_piece) {
+    return true;
+  }
+  return p->key == prev_key;
+}
+
+// Takes back mv, which must be the last move done on p with undo.
+void undo_move(position_t* p, move_t mv, undo_t* undo) {
+  square_t touched[4] = {
+    undo->victim_sq, from_square(mv), intermediate_square(mv), to_square(mv)
+  };
+
+  // The victim's square is empty now, so only the move's squares hold
+  // anything to take off the bitboards.
+  toggle_move_squares(p, touched[1], touched[2], touched[3]);
+
+  // Put the victim back first: it may have been zapped on a square that the
+  // move itself touched.
+  if (undo->victim_sq != 0) {
+    p->board[undo->victim_sq] = undo->victim_piece;
+  }
+  p->board[touched[1]] = undo->from_piece;
+  p->board[touched[2]] = undo->int_piece;
+  p->board[touched[3]] = undo->to_piece;
+
+  toggle_move_squares(p, touched[1], touched[2], touched[3]);
+  if (undo->victim_sq != 0 && undo->victim_sq != touched[1] &&
+      undo->victim_sq != touched[2] && undo->victim_sq != touched[3]) {
+    toggle_bitboards(p, undo->victim_sq, undo->victim_piece);
+  }
+
+  // Only pieces that started on one of these squares can have moved.
+  for (int i = 0; i < 4; i++) {
+    square_t sq = touched[i];
+    piece_t x = p->board[sq];
+    if (sq != 0 && (ptype_of(x) == PAWN || ptype_of(x) == KING)) {
+      p->pieceLocations[color_of(x)][piece_loc_ind(x)] = sq;
+    }
+  }
+
+  p->key = undo->key;
+  p->last_move = undo->last_move;
+  p->victims = undo->victims;
+  p->kloc[WHITE] = undo->kloc[WHITE];
+  p->kloc[BLACK] = undo->kloc[BLACK];
+  p->ply--;
+
+  tbassert(p->key == compute_zob_key(p),
+           "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           p->key, compute_zob_key(p));
+  tbassert(bitboards_ok(p), "bitboards out of sync\n");
+}
+
 // -----------------------------------------------------------------------------
 // Move path enumeration (perft)
 // -----------------------------------------------------------------------------
 
-// Helper function for do_perft() (ply starting with 0).
+int PERFT_HASH;  // megabytes of subtree counts kept by perft, 0 for none
+
+// Below this depth a subtree is too small to be worth handing to other workers
+#define PERFT_SPLIT_DEPTH 3
+
+// A subtree count, stored lockless: check is the key of the entry xor'ed with
+// the count, so an entry torn by two workers writing at once fails to match.
+//
+// https://www.chessprogramming.org/Shared_Hash_Table#Lockless
+typedef struct perftEntry {
+  uint64_t check;
+  uint64_t count;
+} perftEntry_t;
+
+static perftEntry_t* perft_table = NULL;
+static uint64_t perft_table_mask = 0;
+static int perft_table_size = 0;  // megabytes perft_table was allocated with
+
+// (Re)allocates the table to match PERFT_HASH and clears it.
+static void perft_hash_init() {
+  if (perft_table_size != PERFT_HASH) {
+    free(perft_table);
+    perft_table = NULL;
+    perft_table_size = 0;
+    if (PERFT_HASH > 0) {
+      uint64_t entries = 1;
+      while (entries * 2 * sizeof(perftEntry_t) <=
+             ((uint64_t) PERFT_HASH << 20)) {
+        entries *= 2;
+      }
+      perft_table = malloc(entries * sizeof(perftEntry_t));
+      if (perft_table == NULL) {
+        fprintf(stderr, "Could not allocate %d MB of perft hash\n", PERFT_HASH);
+        return;
+      }
+      perft_table_mask = entries - 1;
+      perft_table_size = PERFT_HASH;
+    }
+  }
+  if (perft_table != NULL) {
+    memset(perft_table, 0, (perft_table_mask + 1) * sizeof(perftEntry_t));
+  }
+}
+
+// The same position counts differently at different depths.
+static inline uint64_t perft_key(position_t* p, int depth) {
+  return p->key ^ ((uint64_t) depth * 0x9e3779b97f4a7c15ULL);
+}
+
+static bool perft_probe(uint64_t key, uint64_t* count) {
+  perftEntry_t* e = &perft_table[key & perft_table_mask];
+  uint64_t check = e->check;
+  uint64_t c = e->count;
+  if ((check ^ c) != key) {
+    return false;
+  }
+  *count = c;
+  return true;
+}
+
+static void perft_store(uint64_t key, uint64_t count) {
+  perftEntry_t* e = &perft_table[key & perft_table_mask];
+  e->check = key ^ count;
+  e->count = count;
+}
+
+static uint64_t perft_search(position_t* p, int depth);
+
+// Number of leaves below move mv of p, p left unchanged.
+static uint64_t perft_child(position_t* p, move_t mv, int depth) {
+  position_t child = *p;
+  undo_t undo;
+  victims_t victims = do_move(&child, mv, &undo);
+  if (victims.zapped_count > 0 &&
+      ptype_of(victims.zapped) == KING) {
+    // do not expand further: hit a King
+    return 1;
+  }
+  return perft_search(&child, depth - 1);
+}
+
+// Helper function for do_perft().
 //
-// NOTE: This function reimplements some of the logic for make_move().
-static uint64_t perft_search(position_t* p, int depth, int ply) {
+// Near the leaves moves are done and undone in place on p.  Higher up, every
+// move is searched on its own copy of p so that the moves can run in parallel.
+static uint64_t perft_search(position_t* p, int depth) {
   uint64_t node_count = 0;
-  position_t np;
   sortable_move_t lst[MAX_NUM_MOVES];
   int num_moves;
   int i;
@@ -776,54 +1127,77 @@ static uint64_t perft_search(position_t* p, int depth, int ply) {
     return num_moves;
   }
 
-  for (i = 0; i < num_moves; i++) {
-    move_t mv = get_move(lst[i]);
+  uint64_t key = perft_key(p, depth);
+  if (perft_table != NULL && perft_probe(key, &node_count)) {
+    return node_count;
+  }
 
-    low_level_make_move(p, &np, mv);  // make the move baby!
+  if (depth >= PERFT_SPLIT_DEPTH) {
+    cilk_for (int i = 0; i < num_moves; i++) {
+      uint64_t count = perft_child(p, get_move(lst[i]), depth);
+      __sync_fetch_and_add(&node_count, count);
+    }
+  } else {
+    for (i = 0; i < num_moves; i++) {
+      move_t mv = get_move(lst[i]);
+      undo_t undo;
 
-    square_t victim_sq = 0;  // the guys to disappear
-    np.victims.zapped_count = 0;
+      victims_t victims = do_move(p, mv, &undo);  // make the move baby!
 
-    if ((victim_sq = fire_laser(&np, color_to_move_of(p)))) {  // hit a piece
-      piece_t victim_piece = np.board[victim_sq];
-      tbassert((ptype_of(victim_piece) != EMPTY) &&
-               (ptype_of(victim_piece) != INVALID),
-               "type: %d\n", ptype_of(victim_piece));
+      if (victims.zapped_count > 0 &&
+          ptype_of(victims.zapped) == KING) {
+        // do not expand further: hit a King
+        node_count++;
+      } else {
+        node_count += perft_search(p, depth - 1);
+      }
 
-      remove_piece(&np, victim_sq);
-      np.victims.zapped_count++;
-      np.victims.zapped = victim_piece;
-      np.key ^= zob[victim_sq][victim_piece];   // remove from board
-      np.board[victim_sq] = 0;
-      np.key ^= zob[victim_sq][0];
+      undo_move(p, mv, &undo);
     }
+  }
 
-    if (np.victims.zapped_count > 0 &&
-        ptype_of(np.victims.zapped) == KING) {
-      // do not expand further: hit a King
-      node_count++;
-      continue;
-    }
+  if (perft_table != NULL) {
+    perft_store(key, node_count);
+  }
+  return node_count;
+}
+
+// Prints the count of every root move at depth, in generation order, so that
+// a miscount can be narrowed down to a move by comparing against another
+// move generator.
+static void perft_divide(position_t* p, int depth) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  uint64_t counts[MAX_NUM_MOVES];
+  int num_moves = generate_all(p, lst, true);
 
-    uint64_t partialcount = perft_search(&np, depth - 1, ply + 1);
-    node_count += partialcount;
+  cilk_for (int i = 0; i < num_moves; i++) {
+    counts[i] = perft_child(p, get_move(lst[i]), depth);
   }
 
-  return node_count;
+  for (int i = 0; i < num_moves; i++) {
+    char buf[MAX_CHARS_IN_MOVE];
+    move_to_str(get_move(lst[i]), buf, MAX_CHARS_IN_MOVE);
+    printf("  %-8s %" PRIu64 "\n", buf, counts[i]);
+  }
 }
 
 // Debugging function to help verify that the move generator is working
-// correctly.
+// correctly.  With divide, the count of each root move at the last depth is
+// printed as well.
 //
 // https://www.chessprogramming.org/Perft
-void do_perft(position_t* gme, int depth, int ply) {
+void do_perft(position_t* gme, int depth, bool divide) {
   fen_to_pos(gme, "");
+  perft_hash_init();
 
   for (int d = 1; d <= depth; d++) {
     printf("perft %2d ", d);
-    uint64_t j = perft_search(gme, d, 0);
+    uint64_t j = perft_search(gme, d);
     printf("%" PRIu64 "\n", j);
   }
+  if (divide && depth >= 1) {
+    perft_divide(gme, depth);
+  }
 }
 
 // -----------------------------------------------------------------------------
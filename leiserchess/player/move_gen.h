@@ -19,6 +19,7 @@
 // Used for debugging and display
 #define MAX_CHARS_IN_MOVE 16  // Could be less
 #define MAX_CHARS_IN_TOKEN 64
+#define MAX_CHARS_IN_PATH 1024  // file names of string options
 
 
 
@@ -47,6 +48,23 @@ typedef int8_t fil_t;
 #define RNK_SHIFT 0
 #define RNK_MASK 15
 
+// -----------------------------------------------------------------------------
+// Bitboards
+// -----------------------------------------------------------------------------
+
+// The playable squares are also kept as 64-bit sets, one bit per square, with
+// bit (f * BOARD_WIDTH + r) for file f and rank r.  With this numbering the
+// eight neighbours of a square come out in the same order as dir_of(0..7).
+//
+// https://www.chessprogramming.org/Bitboards
+#define NUM_BB_SQUARES (BOARD_WIDTH * BOARD_WIDTH)
+
+typedef uint64_t bitboard_t;
+
+// Bit index of each array square (-1 for sentinels), and the inverse
+extern int8_t bb_index_of_square[ARR_SIZE];
+extern square_t square_of_bb_index[NUM_BB_SQUARES];
+
 // -----------------------------------------------------------------------------
 // Pieces
 // -----------------------------------------------------------------------------
@@ -173,8 +191,30 @@ typedef struct position {
   move_t       last_move;        // move that led to this position
   victims_t    victims;          // pieces destroyed by shooter
   square_t     kloc[2];          // location of kings
+  bitboard_t   bb_color[2];      // occupied squares, by color
+  bitboard_t   bb_ptype[2];      // occupied squares, by ptype - PAWN
+  bitboard_t   bb_ori[NUM_ORI];  // occupied squares, by orientation
 } position_t;
 
+// Everything needed to take back a move made in place by do_move()
+typedef struct undo {
+  uint64_t     key;              // hash key before the move
+  move_t       last_move;
+  victims_t    victims;
+  square_t     kloc[2];
+  piece_t      from_piece;       // pieces on the move's squares before the move
+  piece_t      int_piece;
+  piece_t      to_piece;
+  square_t     victim_sq;        // 0 if the laser did not zap anything
+  piece_t      victim_piece;
+} undo_t;
+
+// A copy of the Zobrist keys, to put back after drawing new ones
+typedef struct zobKeys {
+  uint64_t     zob[ARR_SIZE][1 << PIECE_SIZE];
+  uint64_t     zob_color;
+} zobKeys_t;
+
 // -----------------------------------------------------------------------------
 // Function prototypes
 // -----------------------------------------------------------------------------
@@ -190,8 +230,14 @@ int ori_of(piece_t x);
 void set_ori(piece_t* x, int ori);
 
 void init_zob();
+void save_zob(zobKeys_t* keys);
+void restore_zob(const zobKeys_t* keys);
 uint64_t compute_zob_key(position_t* p);
 
+void init_bitboards();
+void compute_bitboards(position_t* p);
+bool bitboards_ok(position_t* p);
+
 square_t square_of(fil_t f, rnk_t r);
 fil_t fil_of(square_t sq);
 rnk_t rnk_of(square_t sq);
@@ -213,9 +259,14 @@ void move_to_str(move_t mv, char* buf, size_t bufsize);
 int generate_all(position_t* p, sortable_move_t* sortable_move_list,
                  bool strict);
 int generate_all_with_color(position_t* p, sortable_move_t* sortable_move_list, color_t color_to_move);
-void do_perft(position_t* gme, int depth, int ply);
+bool is_pseudo_legal(position_t* p, move_t mv);
+void do_perft(position_t* gme, int depth, bool divide);
 void low_level_make_move(position_t* old, position_t* p, move_t mv);
 victims_t make_move(position_t* old, position_t* p, move_t mv);
+void low_level_do_move(position_t* p, move_t mv, undo_t* undo);
+victims_t do_move(position_t* p, move_t mv, undo_t* undo);
+bool is_ko_done(position_t* p, move_t mv, undo_t* undo, uint64_t prev_key);
+void undo_move(position_t* p, move_t mv, undo_t* undo);
 void display(position_t* p);
 
 victims_t KO();
@@ -235,7 +286,49 @@ static inline void set_piece_index(piece_t* x, uint8_t i){
 static inline int piece_loc_ind(piece_t piece){
   return (piece >> IND_SHIFT) & IND_MASK;
 }
+
+static inline bitboard_t bb_of_square(square_t sq) {
+  return 1ULL << bb_index_of_square[sq];
+}
+
+// laser_ray_bb[i][bdir]: the squares a beam leaving bit i in direction bdir
+// crosses before it runs off the board.  NN and EE rays grow towards higher
+// bits, SS and WW rays towards lower ones.
+extern bitboard_t laser_ray_bb[NUM_BB_SQUARES][NUM_ORI];
+
+// First occupied square hit by a beam leaving sq in direction bdir, or 0 if
+// the beam runs off the board.
+static inline square_t laser_first_blocker(bitboard_t occupied, square_t sq,
+                                           int bdir) {
+  bitboard_t blockers = laser_ray_bb[bb_index_of_square[sq]][bdir] & occupied;
+  if (!blockers) {
+    return 0;
+  }
+  int i = (bdir == NN || bdir == EE) ? __builtin_ctzll(blockers)
+                                     : 63 - __builtin_clzll(blockers);
+  return square_of_bb_index[i];
+}
+
+// The squares of the ray from sq in direction bdir up to and including
+// blocker (to the edge of the board if blocker is 0).
+static inline bitboard_t laser_segment_bb(square_t sq, int bdir,
+                                          square_t blocker) {
+  bitboard_t ray = laser_ray_bb[bb_index_of_square[sq]][bdir];
+  if (blocker == 0) {
+    return ray;
+  }
+  return ray & ~laser_ray_bb[bb_index_of_square[blocker]][bdir];
+}
+
+// Removes the lowest set bit of *b and returns its square.
+static inline square_t bb_pop_square(bitboard_t* b) {
+  int i = __builtin_ctzll(*b);
+  *b &= *b - 1;
+  return square_of_bb_index[i];
+}
 void remove_piece(position_t* p, square_t sq);
 void update_piececentric(position_t* p, move_t mv);
+square_t fire_laser(position_t* p, color_t c);
+bitboard_t laser_path_bb(position_t* p, color_t c);
 
 #endif  // MOVE_GEN_H
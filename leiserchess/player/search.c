@@ -64,14 +64,27 @@ int DETECT_DRAWS;  // Detect draws by repetition
 // do not set more than 5 ply
 int FUT_DEPTH;     // set to zero for no futilty
 
+// Young Brothers Wait: moves searched serially before the rest go parallel
+int YBWC_PV;       // at PV nodes
+int YBWC_SCOUT;    // at scout nodes
+int SPLIT_DEPTH;   // nodes shallower than this are searched serially
+
+int SMP_MODE;      // SMP_CILK or SMP_LAZY
+int SMP_THREADS;   // threads searching in SMP_LAZY mode, this one included
+int MERGE_ORDERING;  // average the workers' history tables every iteration
+
+int SEARCH_STATS;  // count and report search statistics (see search_stats.c)
+
 
 // Declare the two main search functions.
 static score_t searchPV(searchNode* node, int depth,
                         uint64_t* node_count_serial);
 static score_t scout_search(searchNode* node, int depth,
                             uint64_t* node_count_serial);
+static uint64_t root_rand();
 
 // Include common search functions
+#include "./search_stats.c"
 #include "./search_globals.c"
 #include "./search_common.c"
 #include "./search_scout.c"
@@ -87,13 +100,14 @@ static void initialize_pv_node(searchNode* node, int depth) {
   node->depth = depth;
   node->legal_move_count = 0;
   node->ply = node->parent->ply + 1;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->fake_color_to_move = color_to_move_of(node->position);
   // point of view = 1 for white, -1 for black
   node->pov = 1 - node->fake_color_to_move * 2;
   node->quiescence = (depth <= 0);
   node->best_move_index = 0;
   node->best_score = -INF;
   node->abort = false;
+  node->abort_epoch = node->parent->abort_epoch;
 }
 
 // Perform a Principle Variation Search
@@ -119,19 +133,14 @@ static score_t searchPV(searchNode* node, int depth, uint64_t* node_count_serial
     }
   }
 
-  // Get the killer moves at this node.
-  move_t killer_a = killer[KMT(node->ply, 0)];
-  move_t killer_b = killer[KMT(node->ply, 1)];
-
-
-  // sortable_move_t move_list
+  // picker.moves
   //
   // Contains a list of possible moves at this node. These moves are "sortable"
   //   and can be compared as integers. This is accomplished by using high-order
   //   bits to store a sort key.
   //
   // Keep track of the number of moves that we have considered at this node.
-  //   After we finish searching moves at this node the move_list array will
+  //   After we finish searching moves at this node the picker.moves array will
   //   be organized in the following way:
   //
   //   m0, m1, ... , m_k-1, m_k, ... , m_N-1
@@ -139,104 +148,19 @@ static score_t searchPV(searchNode* node, int depth, uint64_t* node_count_serial
   //  where k = num_moves_tried, and N = num_of_moves
   //
   //  This will allow us to update the best_move_history table easily by
-  //  scanning move_list from index 0 to k such that we update the table
+  //  scanning picker.moves from index 0 to k such that we update the table
   //  only for moves that we actually considered at this node.
-  sortable_move_t move_list[MAX_NUM_MOVES];
-  int num_of_moves = get_sortable_move_list(node, move_list, hash_table_move);
-  int num_moves_tried = 0;
-
-
-
-  // Start searching moves.
-  sort_insertion(move_list, num_of_moves, 0);
-  int num_serial = 2;
-  if (num_of_moves < 2) {num_serial = num_of_moves;}
-  for (int mv_index = 0; mv_index < num_serial; mv_index++) {
-    // Insertion sort the move list.
-    // sort_insertion(move_list, num_of_moves, mv_index);
-
-    move_t mv = get_move(move_list[mv_index]);
-
-    num_moves_tried++;
-    (*node_count_serial)++;
-
-    moveEvaluationResult result = evaluateMove(node, mv, killer_a, killer_b,
-                                               SEARCH_PV,
-                                               node_count_serial);
-
-    if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE) {
-      continue;
-    }
-
-    // A legal move is a move that's not KO, but when we are in quiescence
-    // we only want to count moves that has a capture.
-    if (result.type == MOVE_EVALUATED) {
-      node->legal_move_count++;
-    }
-
-    // Check if we should abort due to time control.
-    if (abortf) {
-      return 0;
-    }
-
-    bool cutoff = search_process_score(node, mv, mv_index, &result, SEARCH_PV);
-    if (cutoff) {
-      break;
-    }
-  }
-  if (abortf) {
-    return 0;
-  }
-  // A simple mutex. See simple_mutex.h for implementation details.
-  simple_mutex_t node_mutex;
-  init_simple_mutex(&node_mutex);
-
-  cilk_for (int mv_index = num_serial; mv_index < num_of_moves; mv_index++) {
-    if (abortf || node->abort) {
-      continue;
-    }
-    // Insertion sort the move list.
-    // sort_insertion(move_list, num_of_moves, mv_index);
+  movePicker picker;
+  init_move_picker(&picker, node, hash_table_move);
+  int num_moves_tried = search_moves(node, &picker, SEARCH_PV,
+                                     node_count_serial);
 
-    move_t mv = get_move(move_list[mv_index]);
-
-    __sync_fetch_and_add(&num_moves_tried,1);
-    __sync_fetch_and_add(node_count_serial, 1);
-
-    moveEvaluationResult result = evaluateMove(node, mv, killer_a, killer_b,
-                                               SEARCH_PV,
-                                               node_count_serial);
-
-    if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE || node->abort) {
-      continue;
-    }
-
-    // A legal move is a move that's not KO, but when we are in quiescence
-    // we only want to count moves that has a capture.
-    if (result.type == MOVE_EVALUATED) {
-      __sync_fetch_and_add(&(node->legal_move_count),1);
-    }
-
-    simple_acquire(&node_mutex);
-    if (node->abort){
-      simple_release(&node_mutex);
-      continue;
-    }
-    bool cutoff = search_process_score(node, mv, mv_index, &result, SEARCH_PV);
-
-    if (cutoff) {
-      node->abort = true;
-      simple_release(&node_mutex);
-      break;
-    }
-    simple_release(&node_mutex);
-  }
-  if (abortf) {
+  if (abortf || parallel_parent_aborted(node)) {
     return 0;
   }
   if (node->quiescence == false) {
-    update_best_move_history(&(node->position), node->best_move_index,
-                             move_list, num_moves_tried);
+    update_best_move_history(node->position, node->best_move_index,
+                             picker.moves, num_moves_tried);
   }
 
   tbassert(abs(node->best_score) != -INF, "best_score = %d\n",
@@ -245,11 +169,9 @@ static score_t searchPV(searchNode* node, int depth, uint64_t* node_count_serial
   // Update the transposition table.
   //
   // Note: This function reads node->best_score, node->orig_alpha,
-  //   node->position.key, node->depth, node->ply, node->beta,
+  //   node->position->key, node->depth, node->ply, node->beta,
   //   node->alpha, node->subpv
-  tt_lock_lock(node->position.key);
   update_transposition_table(node);
-  tt_lock_unlock(node->position.key);
   return node->best_score;
 }
 
@@ -265,138 +187,304 @@ static void initialize_root_node(searchNode* node, score_t alpha, score_t beta,
   node->beta = beta;
   node->depth = depth;
   node->ply = ply;
-  node->position = *p;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->position = p;  // only read: every root move gets a copy
+  node->key = p->key;
+  node->irreversible = !zero_victims(p->victims);
+  node->fake_color_to_move = color_to_move_of(node->position);
   node->best_score = -INF;
   node->pov = 1 - node->fake_color_to_move * 2;  // pov = 1 for White, -1 for Black
   node->abort = false;
+  node->abort_epoch = abort_epoch;
+  node->key_stack_id = 0;  // a new path, for key_stack() to set up
+}
+
+
+// Searches root move mv, the mv_index-th in the root move list, into
+// next_node, and stores its score.  Returns false if mv is not legal.
+static bool search_root_move(searchNode* rootNode, searchNode* next_node,
+                             move_t mv, int mv_index, score_t* score,
+                             uint64_t* node_count_serial) {
+  if (TRACE_MOVES) {
+    print_move_info(mv, rootNode->ply);
+  }
+
+  __sync_fetch_and_add(node_count_serial, 1);
+  // make the move, on a copy: root moves may be searched in parallel
+  position_t position = *rootNode->position;
+  undo_t undo;
+  next_node->position = &position;
+  victims_t x = do_move(&position, mv, &undo);
+  if (is_ko_done(&position, mv, &undo, key_before_last(rootNode))) {
+    return false;  // not a legal move
+  }
+  tt_prefetch(position.key);
+  next_node->key = position.key;
+  next_node->irreversible = !zero_victims(x);
+  if (is_end_game_position(next_node->position, rootNode->pov, rootNode->ply)) {
+    *score = get_end_game_score(next_node->position, rootNode->pov, rootNode->ply);
+    next_node->subpv[0] = 0;
+    return true;
+  }
+  if (is_repeated(rootNode, next_node->position)) {
+    *score = get_draw_score(rootNode->ply);
+    next_node->subpv[0] = 0;
+    return true;
+  }
+  key_stack_push(rootNode, next_node);
+  if (mv_index == 0 || rootNode->depth == 1) {
+    // We guess that the first move is the principle variation
+    *score = -searchPV(next_node, rootNode->depth - 1, node_count_serial);
+  } else {
+    // display(next_node->position);
+    *score = -scout_search(next_node, rootNode->depth - 1, node_count_serial);
+
+    // If its score exceeds the current best score,
+    if (!abortf && *score > rootNode->alpha) {
+      *score = -searchPV(next_node, rootNode->depth - 1, node_count_serial);
+    }
+  }
+  key_stack_pop(rootNode, next_node);
+  return true;
 }
 
+// Folds the score of root move mv into rootNode, and into pv and the root
+// move list when mv is the best so far.  Returns true on a beta cutoff.
+//
+// The search is fail-soft: when no move beats alpha (the window was too
+// high), best_score is the best upper bound found, and pv is left alone so
+// that the caller keeps the previous iteration's move.
+static bool process_root_score(rootState_t* root, searchNode* rootNode,
+                               searchNode* next_node, move_t mv, int mv_index,
+                               score_t score, move_t* pv,
+                               uint64_t* node_count_serial, FILE* OUT) {
+  if (score > rootNode->best_score) {
+    rootNode->best_score = score;
+  }
+
+  if (score > rootNode->alpha) {
+    pv[0] = mv;
+    memcpy(pv + 1, next_node->subpv, sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
+    pv[MAX_PLY_IN_SEARCH - 1] = 0;
+
+    // Print out based on UCI (universal chess interface).  Lazy SMP helpers
+    // search quietly.
+    if (OUT != NULL) {
+      double et = elapsed_time();
+      char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
+      getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
+      if (et < 0.00001) {
+        et = 0.00001;  // hack so that we don't divide by 0
+      }
+
+      uint64_t nps = 1000 * *node_count_serial / et;
+      fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64
+              " nps %" PRIu64 "\n",
+              rootNode->depth, mv_index + 1, (int)(et * 1000),
+              *node_count_serial, nps);
+      fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
+    }
 
-score_t searchRoot(position_t* p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t* pv, uint64_t* node_count_serial,
-                   FILE* OUT) {
-  static int num_of_moves = 0;  // number of moves in list
-  // hopefully, more than we will need
-  static sortable_move_t move_list[MAX_NUM_MOVES];
+    // Slide this move to the front of the move list
+    int j = 0;
+    while (get_move(root->moves[j]) != mv) {
+      j++;
+    }
+    sortable_move_t best = root->moves[j];
+    for (; j > 0; j--) {
+      root->moves[j] = root->moves[j - 1];
+    }
+    root->moves[0] = best;
+
+    // Normal alpha-beta logic: if the current score is better than what the
+    // maximizer has been able to get so far, take that new value.
+    rootNode->alpha = score;
+  }
 
-  if (depth == 1) {
-    // we are at depth 1; generate all possible moves
-    num_of_moves = generate_all(p, move_list, false);
+  // score >= beta is the beta cutoff condition.  It only happens when the
+  // caller narrowed the window (see aspiration windows in leiserchess.c).
+  return score >= rootNode->beta;
+}
+
+// Searches p to depth in the window (alpha, beta), leaving the principal
+// variation found in pv.  root carries the root move list from one iteration
+// to the next: it is (re)generated at depth 1 or when p is new to it, and
+// kept best first.  The first root moves are searched serially, the rest in
+// parallel once they have set alpha.
+score_t searchRoot(rootState_t* root, position_t* p, score_t alpha,
+                   score_t beta, int depth, int ply, move_t* pv,
+                   uint64_t* node_count_serial, FILE* OUT) {
+  if (depth == 1 || root->key != p->key) {
+    // we are at depth 1 (or a Lazy SMP helper starting deeper); generate all
+    // possible moves
+    root->num_moves = generate_all(p, root->moves, false);
+    root->key = p->key;
     // shuffle the list of moves
-    for (int i = 0; i < num_of_moves; i++) {
-      int r = myrand() % num_of_moves;
-      sortable_move_t tmp = move_list[i];
-      move_list[i] = move_list[r];
-      move_list[r] = tmp;
+    for (int i = 0; i < root->num_moves; i++) {
+      int r = root_rand() % root->num_moves;
+      sortable_move_t tmp = root->moves[i];
+      root->moves[i] = root->moves[r];
+      root->moves[r] = tmp;
     }
   }
 
   searchNode rootNode;
   rootNode.parent = NULL;
   initialize_root_node(&rootNode, alpha, beta, depth, ply, p);
+  key_stack(&rootNode);  // before the moves, which may be searched in parallel
 
 
-  assert(rootNode.best_score == alpha);  // initial conditions
+  assert(alpha < beta);  // initial conditions
 
-  searchNode next_node;
-  next_node.subpv[0] = 0;
-  next_node.parent = &rootNode;
+  // Moves are searched in this iteration's order; root->moves gets reordered
+  // as better ones are found.
+  int num_of_moves = root->num_moves;
+  sortable_move_t move_list[MAX_NUM_MOVES];
+  memcpy(move_list, root->moves, sizeof(sortable_move_t) * num_of_moves);
 
-  score_t score;
+  int num_serial = serial_prefix(&rootNode);
+  int mv_index = 0;
+  for (; mv_index < num_of_moves && mv_index < num_serial; mv_index++) {
+    searchNode next_node;
+    next_node.subpv[0] = 0;
+    next_node.parent = &rootNode;
 
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
     move_t mv = get_move(move_list[mv_index]);
-    if (TRACE_MOVES) {
-      print_move_info(mv, ply);
-    }
-
-    (*node_count_serial)++;
-    // make the move.
-    victims_t x = make_move(&(rootNode.position), &(next_node.position), mv);
-    if (is_KO(x)) {
-      continue;  // not a legal move
+    score_t score;
+    if (!search_root_move(&rootNode, &next_node, mv, mv_index, &score,
+                          node_count_serial)) {
+      continue;
     }
-    if (is_end_game_position(&(next_node.position), rootNode.pov, rootNode.ply)) {
-      score = get_end_game_score(&(next_node.position), rootNode.pov, rootNode.ply);
-      next_node.subpv[0] = 0;
-      goto scored;
+    // Check if we should abort due to time control.
+    if (abortf) {
+      return 0;
     }
-    if (is_repeated(&(next_node.position), rootNode.ply)) {
-      score = get_draw_score(&(next_node.position), rootNode.ply);
-      next_node.subpv[0] = 0;
-      goto scored;
+    if (process_root_score(root, &rootNode, &next_node, mv, mv_index, score,
+                           pv, node_count_serial, OUT)) {
+      return rootNode.best_score;
     }
-    if (mv_index == 0 || rootNode.depth == 1) {
-      // We guess that the first move is the principle variation
-      score = -searchPV(&next_node, rootNode.depth - 1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
-    } else {
-      // display(&next_node.position);
-      score = -scout_search(&next_node, rootNode.depth - 1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
+  }
 
-      // If its score exceeds the current best score,
-      if (score > rootNode.alpha) {
-        score = -searchPV(&next_node, rootNode.depth - 1, node_count_serial);
-        // Check if we should abort due to time control.
-        if (abortf) {
-          return 0;
-        }
-      }
-    }
+  // A simple mutex. See simple_mutex.h for implementation details.
+  simple_mutex_t root_mutex;
+  init_simple_mutex(&root_mutex);
 
-  scored:
-    // only valid for the root node:
-    tbassert((score > rootNode.best_score) == (score > rootNode.alpha),
-             "score = %d, best = %d, alpha = %d\n", score, rootNode.best_score, rootNode.alpha);
+  cilk_for (int i = mv_index; i < num_of_moves; i++) {
+    if (abortf || rootNode.abort) {
+      continue;
+    }
+    searchNode next_node;
+    next_node.subpv[0] = 0;
+    next_node.parent = &rootNode;
+
+    move_t mv = get_move(move_list[i]);
+    score_t score;
+    if (!search_root_move(&rootNode, &next_node, mv, i, &score,
+                          node_count_serial) || abortf) {
+      continue;
+    }
+    simple_acquire(&root_mutex);
+    if (!rootNode.abort &&
+        process_root_score(root, &rootNode, &next_node, mv, i, score, pv,
+                           node_count_serial, OUT)) {
+      abort_node(&rootNode);
+    }
+    simple_release(&root_mutex);
+  }
+  // Check if we should abort due to time control.
+  if (abortf) {
+    return 0;
+  }
 
-    if (score > rootNode.best_score) {
-      tbassert(score > rootNode.alpha, "score: %d, alpha: %d\n", score, rootNode.alpha);
+  return rootNode.best_score;
+}
 
-      rootNode.best_score = score;
-      pv[0] = mv;
-      memcpy(pv + 1, next_node.subpv, sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-      pv[MAX_PLY_IN_SEARCH - 1] = 0;
+// -----------------------------------------------------------------------------
+// Lazy SMP
+//
+// In SMP_LAZY mode, SMP_THREADS - 1 helper threads run their own iterative
+// deepening next to the main one.  They share nothing but the transposition
+// table (and the move ordering tables), and only feed it: their results are
+// never reported.  Odd helpers run a ply ahead of the others, and each helper
+// orders the root moves differently, so that they do not all search the same
+// tree in lock-step.
+//
+// https://www.chessprogramming.org/Lazy_SMP
+// -----------------------------------------------------------------------------
 
-      // Print out based on UCI (universal chess interface)
-      double et = elapsed_time();
-      char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
-      getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
-      if (et < 0.00001) {
-        et = 0.00001;  // hack so that we don't divide by 0
-      }
+typedef struct {
+  pthread_t thread;
+  int id;    // 1 for the first helper, 2 for the next, ...
+  int slot;  // worker slot, past the cilk workers' (see util.h)
+  int depth;
+  position_t position;
+  rootState_t root;
+  uint64_t node_count;
+} smpHelper;
+
+static smpHelper smp_helpers[MAX_WORKERS];
+static int smp_num_helpers = 0;
+
+static __thread uint64_t helper_rng;
+
+// Random numbers for shuffling the root moves.  The main thread draws from
+// myrand() so that reset_rng keeps single-threaded searches reproducible.
+static uint64_t root_rand() {
+  if (thread_worker_slot < 0) {
+    return myrand();
+  }
+  helper_rng = helper_rng * 6364136223846793005ULL + 1442695040888963407ULL;
+  return helper_rng >> 33;
+}
 
-      uint64_t nps = 1000 * *node_count_serial / et;
-      fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64
-              " nps %" PRIu64 "\n",
-              depth, mv_index + 1, (int)(et * 1000), *node_count_serial, nps);
-      fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
+static void* smp_helper_main(void* arg) {
+  smpHelper* helper = (smpHelper*) arg;
+  move_t pv[MAX_PLY_IN_SEARCH];
 
-      // Slide this move to the front of the move list
-      for (int j = mv_index; j > 0; j--) {
-        move_list[j] = move_list[j - 1];
-      }
-      move_list[0] = mv;
-    }
+  thread_worker_slot = helper->slot;
+  helper_rng = helper->id;
+  for (int d = 1 + (helper->id & 1); d <= helper->depth && !abortf; d++) {
+    searchRoot(&helper->root, &helper->position, -INF, INF, d, 0, pv,
+               &helper->node_count, NULL);
+  }
+  return NULL;
+}
 
-    // Normal alpha-beta logic: if the current score is better than what the
-    // maximizer has been able to get so far, take that new value.  Likewise,
-    // score >= beta is the beta cutoff condition
-    if (score > rootNode.alpha) {
-      rootNode.alpha = score;
-    }
-    if (score >= rootNode.beta) {
-      tbassert(0, "score: %d, beta: %d\n", score, rootNode.beta);
+// Starts the helper threads on p, to search at most depth plies, and returns
+// how many were started.  Does nothing unless in SMP_LAZY mode.
+int smp_start_helpers(position_t* p, int depth) {
+  if (SMP_MODE != SMP_LAZY) {
+    return 0;
+  }
+  tbassert(smp_num_helpers == 0, "helpers already running\n");
+  for (int i = 0; i < SMP_THREADS - 1 && first_helper_slot() + i < MAX_WORKERS;
+       i++) {
+    smpHelper* helper = &smp_helpers[i];
+    helper->id = i + 1;
+    helper->slot = first_helper_slot() + i;
+    helper->depth = depth;
+    helper->position = *p;
+    helper->root.key = 0;
+    helper->node_count = 0;
+    if (pthread_create(&helper->thread, NULL, smp_helper_main, helper) != 0) {
       break;
     }
+    smp_num_helpers++;
   }
+  return smp_num_helpers;
+}
 
-  return rootNode.best_score;
+// Stops the helper threads, once the main search is over.  Returns the number
+// of nodes they searched.
+uint64_t smp_stop_helpers() {
+  uint64_t node_count = 0;
+  if (smp_num_helpers == 0) {
+    return 0;
+  }
+  abortf = true;
+  for (int i = 0; i < smp_num_helpers; i++) {
+    pthread_join(smp_helpers[i].thread, NULL);
+    node_count += smp_helpers[i].node_count;
+  }
+  smp_num_helpers = 0;
+  return node_count;
 }
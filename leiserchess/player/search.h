@@ -56,23 +56,56 @@ typedef struct searchNode {
   int pov;
   int legal_move_count;
   bool abort;
+  uint64_t abort_epoch;  // abort epoch as of which no ancestor had aborted
+  uint64_t key_stack_id;  // identifies the node's path in a key stack
+  uint64_t key;           // of the position, which the children may move on
+  bool irreversible;      // the move to the node zapped a piece
   score_t best_score;
   int best_move_index;
-  position_t position;
+  // Children searched one at a time move on the node's position in place and
+  // take their move back afterwards; children searched in parallel each get
+  // a copy.  Below the root, the history of a position is not kept up.
+  position_t* position;
   move_t subpv[MAX_PLY_IN_SEARCH];
 } searchNode;
 
+// State a search keeps at the root from one iteration to the next.  Each
+// search owns its own, so that searches can run side by side.
+typedef struct rootState {
+  uint64_t key;  // position the moves are for
+  int num_moves;
+  sortable_move_t moves[MAX_NUM_MOVES];  // best first, once searched
+} rootState_t;
+
 
 void init_tics();
-void init_abort_timer(double goal_time);
+void set_search_thread();
+void post_search_task(void (*task)());
+void run_search_task();
+void init_abort_timer(double time_limit);
 double elapsed_time();
 bool should_abort();
 void reset_abort();
+void stop_search();
 void init_best_move_history();
+void merge_move_ordering();
+void clear_move_ordering();
+
+// Values of the smp_mode option
+#define SMP_CILK 0  // split the tree among cilk workers (Young Brothers Wait)
+#define SMP_LAZY 1  // independent searches sharing the transposition table
+
+// Search statistics (see search_stats.c)
+void search_stats_reset();
+void search_stats_iteration(int depth, double et, bool aborted, FILE* out);
+void search_stats_dump(FILE* out);
+
+int smp_start_helpers(position_t* p, int depth);
+uint64_t smp_stop_helpers();
 move_t get_move(sortable_move_t sortable_mv);
-score_t searchRoot(position_t* p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t* pv, uint64_t* node_count_serial,
-                   FILE* OUT);
+score_t searchRoot(rootState_t* root, position_t* p, score_t alpha,
+                   score_t beta, int depth, int ply, move_t* pv,
+                   uint64_t* node_count_serial, FILE* OUT);
 
 
 #endif  // SEARCH_H
@@ -5,6 +5,11 @@ static int     tics = 0;
 static double  sstart;    // start time of a search in milliseconds
 static double  timeout;   // time elapsed before abort
 static bool    abortf = false;  // abort flag for search
+// bumped whenever a node aborts its parallel brothers; see chain_aborted()
+static volatile uint64_t abort_epoch = 0;
+// posted by another thread for the search thread to run (see run_search_task())
+static void (*volatile search_task)() = NULL;
+static __thread bool is_search_thread = false;
 
 static score_t fmarg[10] = {
   0, PAWN_VALUE / 2, PAWN_VALUE, (PAWN_VALUE * 5) / 2, (PAWN_VALUE * 9) / 2,
@@ -19,10 +24,11 @@ typedef enum {
   MOVE_GAMEOVER
 } moveEvaluationResult_t;
 
+// The child node a move leads to is not part of the result: it is owned by the
+// caller, which passes it in to evaluateMove() and reads its subpv after.
 typedef struct moveEvaluationResult {
   score_t score;
   moveEvaluationResult_t type;
-  searchNode next_node;
 } moveEvaluationResult;
 
 typedef struct leafEvalResult {
@@ -51,10 +57,11 @@ static void set_sort_key(sortable_move_t* mv, sort_key_t key) {
   return;
 }
 
-void init_abort_timer(double goal_time) {
+// Starts timing a search that must abort after time_limit milliseconds (see
+// tm_maximum() in timeman.c).
+void init_abort_timer(double time_limit) {
   sstart = milliseconds();
-  // don't go over any more than 3 times the goal
-  timeout = sstart + goal_time * 3.0;
+  timeout = sstart + time_limit;
 }
 
 double elapsed_time() {
@@ -69,63 +76,185 @@ void reset_abort() {
   abortf = false;
 }
 
+// Stops the search at its next abort check, as if it had run out of time.
+//   Unlike abortf, this survives the reset_abort() between iterations.
+void stop_search() {
+  abort_requested = milliseconds();
+  timeout = 0;
+  abortf = true;
+}
+
 void init_tics() {
   tics = 0;
 }
 
+// Marks the calling thread as the one that runs iterative deepening.
+void set_search_thread() {
+  is_search_thread = true;
+}
+
+// Has the search thread run task at its next abort check or at the end of the
+// iteration, so that another thread (the UCI loop on ponderhit) can act on
+// state only the search thread may touch, such as the time manager's.
+void post_search_task(void (*task)()) {
+  search_task = task;
+}
+
+// Runs the task posted last, if any, when called on the search thread.
+void run_search_task() {
+  if (is_search_thread && search_task != NULL) {
+    void (*task)() = __sync_lock_test_and_set(&search_task, NULL);
+    if (task != NULL) {
+      task();
+    }
+  }
+}
+
 move_t get_move(sortable_move_t sortable_mv) {
   return (move_t)(sortable_mv & MOVE_MASK);
 }
 
-static score_t get_draw_score(position_t* p, int ply) {
-  position_t* x = p->history;
-  uint64_t cur = p->key;
-  score_t score;
-  while (true) {
-    if (!zero_victims(x->victims)) {
-      break;  // cannot be a repetition
-    }
-    x = x->history;
-    if (!zero_victims(x->victims)) {
-      break;  // cannot be a repetition
-    }
-    if (x->key == cur) {  // is a repetition
-      if (ply & 1) {
-        score = -DRAW;
-      } else {
-        score = DRAW;
+// -----------------------------------------------------------------------------
+// Repetition detection
+//
+// Each worker keeps the keys of the positions from the last irreversible one
+// (reached by a move that zapped something, past which nothing can repeat) up
+// to the node it is searching in a key stack, so that a repetition check is a
+// scan of a dense array rather than a walk up the position history.  The key
+// of a child is pushed before it is searched and popped after.
+//
+// A stack holds the path of one node, recorded by the node's key_stack_id.  A
+// worker that finds it holds some other path, because it stole the node's
+// moves from a cilk_for or resumed its continuation after a sync, rebuilds it
+// from the position history, which reaches back through the ancestors' nodes
+// into the game.  Stacks are never shared: worker_id() gives every thread
+// that searches a slot of its own (see util.h).
+//
+// https://www.chessprogramming.org/Repetitions
+// -----------------------------------------------------------------------------
+
+#define KEY_STACK_SIZE (MAX_PLY_IN_GAME + MAX_PLY_IN_SEARCH)
+
+typedef struct keyStack {
+  uint64_t node_id;  // key_stack_id of the node whose path this is
+  uint64_t next_id;  // ids handed out by this worker so far
+  int top;           // index of the node's position
+  uint64_t keys[KEY_STACK_SIZE];
+  int16_t irreversible[KEY_STACK_SIZE];  // last irreversible index up to each
+} __attribute__((aligned(64))) keyStack_t;
+
+static keyStack_t key_stacks[MAX_WORKERS];
+
+// Returns a key_stack_id no other node has, from worker w's stack ks.
+static uint64_t new_key_stack_id(keyStack_t* ks, int w) {
+  return ++ks->next_id * MAX_WORKERS + w;
+}
+
+// Returns the calling worker's key stack, holding the path of node.
+static keyStack_t* key_stack(searchNode* node) {
+  int w = worker_id();
+  keyStack_t* ks = &key_stacks[w];
+  if (ks->node_id == node->key_stack_id && node->key_stack_id != 0) {
+    tbassert(0 <= ks->top && ks->top < KEY_STACK_SIZE, "top: %d\n", ks->top);
+    return ks;
+  }
+
+  // Rebuild: collect the keys back to the irreversible position, newest first,
+  // from the nodes up to the root (whose positions children may have moved
+  // on) and from the game's positions before it, then turn them around.
+  int limit = KEY_STACK_SIZE - MAX_PLY_IN_SEARCH;
+  int n = 0;
+  searchNode* x = node;
+  ks->keys[n++] = x->key;
+  while (!x->irreversible && x->parent != NULL && n < limit) {
+    x = x->parent;
+    ks->keys[n++] = x->key;
+  }
+  if (!x->irreversible && x->parent == NULL) {
+    for (position_t* y = x->position->history; y != NULL && n < limit;
+         y = y->history) {
+      ks->keys[n++] = y->key;
+      if (!zero_victims(y->victims)) {
+        break;
       }
-      return score;
     }
-    x = x->history;
   }
-  assert(false);  // This should not occur.
-  return (score_t) 0;
+  for (int i = 0; i < n; i++) {
+    if (i < n - 1 - i) {
+      uint64_t key = ks->keys[i];
+      ks->keys[i] = ks->keys[n - 1 - i];
+      ks->keys[n - 1 - i] = key;
+    }
+    ks->irreversible[i] = 0;
+  }
+  ks->top = n - 1;
+  if (node->key_stack_id == 0) {
+    node->key_stack_id = new_key_stack_id(ks, w);
+  }
+  ks->node_id = node->key_stack_id;
+  return ks;
+}
+
+// Pushes the position of next_node, a child of node, about to be searched.
+static void key_stack_push(searchNode* node, searchNode* next_node) {
+  keyStack_t* ks = key_stack(node);
+  int top = ks->top;
+  if (top + 1 == KEY_STACK_SIZE) {
+    next_node->key_stack_id = 0;  // to be rebuilt, shorter
+    return;
+  }
+  ks->keys[top + 1] = next_node->key;
+  ks->irreversible[top + 1] =
+      next_node->irreversible ? top + 1 : ks->irreversible[top];
+  ks->top = top + 1;
+  next_node->key_stack_id = new_key_stack_id(ks, worker_id());
+  ks->node_id = next_node->key_stack_id;
+}
+
+// Pops next_node, pushed by key_stack_push, once it has been searched.  If
+// the search moved to another worker, or this one's stack was taken over,
+// there is nothing to pop: the stack is rebuilt when next needed.  So it is
+// if it was rebuilt for next_node alone, which leaves node out.
+static void key_stack_pop(searchNode* node, searchNode* next_node) {
+  keyStack_t* ks = &key_stacks[worker_id()];
+  if (ks->node_id == next_node->key_stack_id && ks->node_id != 0) {
+    if (ks->top > 0) {
+      ks->top--;
+      ks->node_id = node->key_stack_id;
+    } else {
+      ks->node_id = 0;
+    }
+  }
 }
 
+// Key of the position before the move to node, for the Ko rule, or 0 if there
+// is none
+static uint64_t key_before_last(searchNode* node) {
+  if (node->parent != NULL) {
+    return node->parent->key;
+  }
+  position_t* prev = node->position->history;  // the root's is the game's
+  return prev != NULL ? prev->key : 0;
+}
 
+// Score of a draw by repetition found below a node at ply
+static score_t get_draw_score(int ply) {
+  return (ply & 1) ? -DRAW : DRAW;
+}
 
-// Detect move repetition
-static bool is_repeated(position_t* p, int ply) {
+// Detect move repetition: whether p, reached from node, repeats a position
+// since the last irreversible one with the same side to move.
+static bool is_repeated(searchNode* node, position_t* p) {
   if (!DETECT_DRAWS) {
     return false;  // no draw detected
   }
 
-  position_t* x = p->history;
+  keyStack_t* ks = key_stack(node);
   uint64_t cur = p->key;
-
-  while (true) {
-    if (!zero_victims(x->victims)) {
-      break;  // cannot be a repetition
-    }
-    x = x->history;
-    if (!zero_victims(x->victims)) {
-      break;  // cannot be a repetition
-    }
-    if (x->key == cur) {  // is a repetition
+  for (int i = ks->top - 1; i > ks->irreversible[ks->top]; i -= 2) {
+    if (ks->keys[i] == cur) {  // is a repetition
       return true;
     }
-    x = x->history;
   }
   return false;
 }
@@ -166,9 +295,12 @@ leafEvalResult evaluate_as_leaf(searchNode* node, searchType_t type) {
   // get transposition table record if available.
   //
   // https://www.chessprogramming.org/Transposition_Table
-  ttRec_t* rec = tt_hashtable_get(node->position.key);
+  ttRec_t* rec = tt_hashtable_get(node->position->key);
+  STATS_ADD(tt_probes, 1);
   if (rec) {
+    STATS_ADD(tt_hits, 1);
     if (type == SEARCH_SCOUT && tt_is_usable(rec, node->depth, node->beta)) {
+      STATS_ADD(tt_usable, 1);
       result.type = MOVE_EVALUATED;
       result.score = tt_adjust_score_from_hashtable(rec, node->ply);
       return result;
@@ -179,7 +311,7 @@ leafEvalResult evaluate_as_leaf(searchNode* node, searchType_t type) {
   // stand pat (having-the-move) bonus
   //
   // https://www.chessprogramming.org/Quiescence_Search#Standing_Pat
-  score_t sps = eval(&(node->position), false) + HMB;
+  score_t sps = eval(node->position, false) + HMB;
   bool quiescence = (node->depth <= 0);  // are we in quiescence?
   result.should_enter_quiescence = quiescence;
   if (quiescence) {
@@ -194,11 +326,13 @@ leafEvalResult evaluate_as_leaf(searchNode* node, searchType_t type) {
   if (type == SEARCH_SCOUT && USE_NMM) {
     if (node->depth <= 2) {
       if (node->depth == 1 && sps >= node->beta + 3 * PAWN_VALUE) {
+        STATS_ADD(nmm_prunes, 1);
         result.type = MOVE_EVALUATED;
         result.score = node->beta;
         return result;
       }
       if (node->depth == 2 && sps >= node->beta + 5 * PAWN_VALUE) {
+        STATS_ADD(nmm_prunes, 1);
         result.type = MOVE_EVALUATED;
         result.score = node->beta;
         return result;
@@ -212,6 +346,7 @@ leafEvalResult evaluate_as_leaf(searchNode* node, searchType_t type) {
   if (type == SEARCH_SCOUT && node->depth <= FUT_DEPTH && node->depth > 0) {
     if (sps + fmarg[node->depth] < node->beta) {
       // treat this ply as a quiescence ply, look only at captures
+      STATS_ADD(fut_prunes, 1);
       result.should_enter_quiescence = true;
       result.score = sps;
     }
@@ -219,32 +354,39 @@ leafEvalResult evaluate_as_leaf(searchNode* node, searchType_t type) {
   return result;
 }
 
-// Evaluate the move by performing a search.
-moveEvaluationResult evaluateMove(searchNode* node, move_t mv, move_t killer_a,
-                                  move_t killer_b, searchType_t type,
+// Evaluate the move by performing a search of next_node, the node mv leads
+// to, which the caller provides.  The move is done on next_node->position,
+// which holds node's position, with undo to take it back; the caller does
+// that once it is done with next_node.
+moveEvaluationResult evaluateMove(searchNode* node, searchNode* next_node,
+                                  move_t mv, undo_t* undo,
+                                  move_t killer_a, move_t killer_b,
+                                  searchType_t type,
                                   uint64_t* node_count_serial) {
   int ext = 0;  // extensions
   bool blunder = false;  // shoot our own piece
   moveEvaluationResult result;
-  result.next_node.subpv[0] = 0;
-  result.next_node.parent = node;
+  next_node->subpv[0] = 0;
+  next_node->parent = node;
 
   // Make the move, and get any victim pieces.
-  victims_t victims = make_move(&(node->position), &(result.next_node.position),
-                                mv);
+  victims_t victims = do_move(next_node->position, mv, undo);
 
   // Check whether this move changes the board state (moves that don't are
   // illegal).
-  if (is_KO(victims)) {
+  if (is_ko_done(next_node->position, mv, undo, key_before_last(node))) {
     result.type = MOVE_ILLEGAL;
     return result;
   }
+  tt_prefetch(next_node->position->key);
+  next_node->key = next_node->position->key;
+  next_node->irreversible = !zero_victims(victims);
 
   // Check whether the game is a game over position - either someone was shot or it's in our closing book.
-  if (is_end_game_position(&(result.next_node.position), node->pov, node->ply)) {
+  if (is_end_game_position(next_node->position, node->pov, node->ply)) {
     // Compute the end-game score.
     result.type = MOVE_GAMEOVER;
-    result.score = get_end_game_score(&(result.next_node.position), node->pov, node->ply);
+    result.score = get_end_game_score(next_node->position, node->pov, node->ply);
     return result;
   }
 
@@ -255,9 +397,9 @@ moveEvaluationResult evaluateMove(searchNode* node, move_t mv, move_t killer_a,
   }
 
   // Check whether the board state has been repeated, this results in a draw.
-  if (is_repeated(&(result.next_node.position), node->ply)) {
+  if (is_repeated(node, next_node->position)) {
     result.type = MOVE_GAMEOVER;
-    result.score = get_draw_score(&(result.next_node.position), node->ply);
+    result.score = get_draw_score(node->ply);
     return result;
   }
 
@@ -307,19 +449,24 @@ moveEvaluationResult evaluateMove(searchNode* node, move_t mv, move_t killer_a,
   //
   // After a reduced-depth search, a full-depth search will be performed if the
   //  reduced-depth search did not trigger a cut-off.
+  key_stack_push(node, next_node);
   if (next_reduction > 0) {
+    STATS_ADD(lmr_reductions, 1);
     search_depth -= next_reduction;
-    int reduced_depth_score = -scout_search(&(result.next_node), search_depth,
+    int reduced_depth_score = -scout_search(next_node, search_depth,
                                             node_count_serial);
     if (reduced_depth_score < node->beta) {
+      key_stack_pop(node, next_node);
       result.score = reduced_depth_score;
       return result;
     }
+    STATS_ADD(lmr_researches, 1);
     search_depth += next_reduction;
   }
 
   // Check if we should abort due to time control.
   if (abortf) {
+    key_stack_pop(node, next_node);
     result.score = 0;
     result.type = MOVE_IGNORE;
     return result;
@@ -327,19 +474,20 @@ moveEvaluationResult evaluateMove(searchNode* node, move_t mv, move_t killer_a,
 
 
   if (type == SEARCH_SCOUT) {
-    result.score = -scout_search(&(result.next_node), search_depth,
+    result.score = -scout_search(next_node, search_depth,
                                  node_count_serial);
   } else {
     if (node->legal_move_count == 0 || node->quiescence) {
-      result.score = -searchPV(&(result.next_node), search_depth, node_count_serial);
+      result.score = -searchPV(next_node, search_depth, node_count_serial);
     } else {
-      result.score = -scout_search(&(result.next_node), search_depth,
+      result.score = -scout_search(next_node, search_depth,
                                    node_count_serial);
       if (result.score > node->alpha) {
-        result.score = -searchPV(&(result.next_node), node->depth + ext - 1, node_count_serial);
+        result.score = -searchPV(next_node, node->depth + ext - 1, node_count_serial);
       }
     }
   }
+  key_stack_pop(node, next_node);
 
   return result;
 }
@@ -358,26 +506,34 @@ void sort_insertion(sortable_move_t* move_list, int num_of_moves, int mv_index)
 }
 
 // Returns true if a cutoff was triggered, false otherwise.
-bool search_process_score(searchNode* node, move_t mv, int mv_index,
-                          moveEvaluationResult* result, searchType_t type) {
+bool search_process_score(searchNode* node, searchNode* next_node, move_t mv,
+                          int mv_index, moveEvaluationResult* result,
+                          searchType_t type) {
   if (result->score > node->best_score) {
     node->best_score = result->score;
     node->best_move_index = mv_index;
     node->subpv[0] = mv;
 
-    // write best move into right position in PV buffer.
-    memcpy(node->subpv + 1, result->next_node.subpv,
-           sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-    node->subpv[MAX_PLY_IN_SEARCH - 1] = 0;
+    // write best move into right position in PV buffer.  Only the moves up to
+    // the terminating 0 matter, and most lines are short.
+    int i = 0;
+    while (i < MAX_PLY_IN_SEARCH - 2 && next_node->subpv[i] != 0) {
+      node->subpv[i + 1] = next_node->subpv[i];
+      i++;
+    }
+    node->subpv[i + 1] = 0;
 
     if (type != SEARCH_SCOUT && result->score > node->alpha) {
       node->alpha = result->score;
     }
 
     if (result->score >= node->beta) {
+      moveOrderingTables* tables = worker_move_ordering();
+      move_t* killer = tables->killer;
       if (mv != killer[KMT(node->ply, 0)] && ENABLE_TABLES) {
         killer[KMT(node->ply, 1)] = killer[KMT(node->ply, 0)];
         killer[KMT(node->ply, 0)] = mv;
+        tables->used = true;
       }
       return true;
     }
@@ -387,9 +543,14 @@ bool search_process_score(searchNode* node, move_t mv, int mv_index,
 
 // Check if we should abort.
 bool should_abort_check() {
+  if (abortf) {
+    return true;
+  }
   tics++;
   if ((tics & ABORT_CHECK_PERIOD) == 0) {
+    run_search_task();
     if (milliseconds() >= timeout) {
+      abort_requested = timeout;
       abortf = true;
       return true;
     }
@@ -397,39 +558,343 @@ bool should_abort_check() {
   return false;
 }
 
-// Obtain a sorted move list.
+// Aborts node after a cutoff found while its moves are searched in parallel.
+//   The brothers still running notice it through parallel_parent_aborted().
+static void abort_node(searchNode* node) {
+  node->abort = true;
+  __sync_fetch_and_add(&abort_epoch, 1);
+}
+
+// Checks whether n or one of its ancestors has aborted.  Nodes only abort via
+//   abort_node() once the search below them has gone parallel, which is rare,
+//   so the walk up the tree is skipped unless some node anywhere has aborted
+//   since n was last found clean.
+static bool chain_aborted(searchNode* n) {
+  uint64_t epoch = abort_epoch;
+  if (epoch == n->abort_epoch) {
+    return false;
+  }
+  for (searchNode* pred = n; pred != NULL; pred = pred->parent) {
+    if (pred->abort) {
+      return true;
+    }
+  }
+  n->abort_epoch = epoch;
+  return false;
+}
+
+// Checks whether a node's parent has aborted.
+//   If this occurs, we should just stop and return 0 immediately.
+bool parallel_parent_aborted(searchNode* node) {
+  return node->parent != NULL && chain_aborted(node->parent);
+}
+
+// Checks whether this node has aborted due to a cut-off.
+//   If this occurs, we should actually return the score.
+bool parallel_node_aborted(searchNode* node) {
+  if (node->abort) {
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// Staged move picker
+// -----------------------------------------------------------------------------
+
+// Hands out the moves of a node best first, doing as little work as it can
+// before the first few moves are searched: the hash move and the killers are
+// tried before anything is generated, and the rest are generated only when
+// those did not cut off, then picked by selection.  The moves come out in the
+// same order as a full sort would give: hash move, killer a, killer b, then
+// by best_move_history.
+//
+// Every move handed out is appended to moves[], so moves[0..next) are the
+// moves tried so far, in order, as update_best_move_history() expects.
 //
 // https://www.chessprogramming.org/Move_Ordering
-static int get_sortable_move_list(searchNode* node, sortable_move_t* move_list,
-                                  int hash_table_move) {
-  // number of moves in list
-  int num_of_moves = generate_all(&(node->position), move_list, false);
-
-  color_t fake_color_to_move = color_to_move_of(&(node->position));
-
-  move_t killer_a = killer[KMT(node->ply, 0)];
-  move_t killer_b = killer[KMT(node->ply, 1)];
-
-  // sort special moves to the front
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    move_t mv = get_move(move_list[mv_index]);
-    if (mv == hash_table_move) {
-      set_sort_key(&move_list[mv_index], SORT_MASK);
-    } else if (mv == killer_a) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 1);
-    } else if (mv == killer_b) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 2);
+// https://www.chessprogramming.org/Move_Ordering#Staged_Move_Generation
+typedef enum {
+  PICK_HASH,
+  PICK_KILLER_A,
+  PICK_KILLER_B,
+  PICK_GENERATE,
+  PICK_REST
+} pickStage_t;
+
+typedef struct movePicker {
+  sortable_move_t moves[MAX_NUM_MOVES];
+  int num_moves;  // moves in moves[], tried or not
+  int next;       // moves[0..next) have been handed out
+  pickStage_t stage;
+  move_t hash_move;
+  move_t killer_a;
+  move_t killer_b;
+} movePicker;
+
+static void init_move_picker(movePicker* mp, searchNode* node,
+                             move_t hash_move) {
+  mp->num_moves = 0;
+  mp->next = 0;
+  mp->stage = PICK_HASH;
+  mp->hash_move = hash_move;
+  move_t* killer = worker_move_ordering()->killer;
+  mp->killer_a = killer[KMT(node->ply, 0)];
+  mp->killer_b = killer[KMT(node->ply, 1)];
+}
+
+static bool already_picked(movePicker* mp, move_t mv) {
+  for (int i = 0; i < mp->next; i++) {
+    if (get_move(mp->moves[i]) == mv) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Generates the moves not handed out yet into moves[next..num_moves) with
+// their sort keys.
+static void generate_remaining(movePicker* mp, searchNode* node) {
+  position_t* p = node->position;
+  color_t fake_color_to_move = color_to_move_of(p);
+  int* best_move_history = worker_move_ordering()->best_move_history;
+  sortable_move_t* rest = mp->moves + mp->next;
+  int num_rest = generate_all(p, rest, false);
+  int num_picked = 0;
+
+  for (int i = 0; i < num_rest; i++) {
+    move_t mv = get_move(rest[i]);
+    if (already_picked(mp, mv)) {
+      rest[i--] = rest[--num_rest];
+      num_picked++;
+      continue;
+    }
+    // A hash move or killer lands here if the picker is asked for all the
+    // remaining moves before reaching it.
+    if (mv == mp->hash_move) {
+      set_sort_key(&rest[i], SORT_MASK);
+      continue;
+    } else if (mv == mp->killer_a) {
+      set_sort_key(&rest[i], SORT_MASK - 1);
+      continue;
+    } else if (mv == mp->killer_b) {
+      set_sort_key(&rest[i], SORT_MASK - 2);
+      continue;
+    }
+    ptype_t  pce = ptype_mv_of(mv);
+    rot_t    ro  = rot_of(mv);   // rotation
+    square_t fs  = from_square(mv);
+    int      ot  = ORI_MASK & (ori_of(p->board[fs]) + ro);
+    square_t ts  = to_square(mv);
+    set_sort_key(&rest[i],
+                 best_move_history[BMH(fake_color_to_move, pce, ts, ot)]);
+  }
+  // every move handed out so far must have been a generated one
+  tbassert(num_picked == mp->next, "picked %d of %d\n", num_picked, mp->next);
+  mp->num_moves = mp->next + num_rest;
+}
+
+// Returns the next move to try, or 0 when there are none left.
+static move_t next_move(movePicker* mp, searchNode* node) {
+  position_t* p = node->position;
+  move_t mv = 0;
+
+  switch (mp->stage) {
+  case PICK_HASH:
+    mp->stage = PICK_KILLER_A;
+    mv = mp->hash_move;
+    if (mv != 0 && is_pseudo_legal(p, mv)) {
+      break;
+    }
+    // fall through
+  case PICK_KILLER_A:
+    mp->stage = PICK_KILLER_B;
+    mv = mp->killer_a;
+    if (mv != 0 && mv != mp->hash_move && is_pseudo_legal(p, mv)) {
+      break;
+    }
+    // fall through
+  case PICK_KILLER_B:
+    mp->stage = PICK_GENERATE;
+    mv = mp->killer_b;
+    if (mv != 0 && mv != mp->hash_move && mv != mp->killer_a &&
+        is_pseudo_legal(p, mv)) {
+      break;
+    }
+    // fall through
+  case PICK_GENERATE:
+    mp->stage = PICK_REST;
+    generate_remaining(mp, node);
+    // fall through
+  case PICK_REST:
+    if (mp->next == mp->num_moves) {
+      return 0;
+    }
+    // selection: swap the best remaining move to the front
+    for (int i = mp->next + 1; i < mp->num_moves; i++) {
+      if (mp->moves[i] > mp->moves[mp->next]) {
+        sortable_move_t tmp = mp->moves[i];
+        mp->moves[i] = mp->moves[mp->next];
+        mp->moves[mp->next] = tmp;
+      }
+    }
+    return get_move(mp->moves[mp->next++]);
+  }
+
+  // a hash move or killer
+  mp->moves[mp->next++] = mv;
+  mp->num_moves = mp->next;
+  return mv;
+}
+
+// Generates whatever is left and sorts it, for searching all remaining moves
+// at once.  Returns the total number of moves; moves[next..total) are the
+// ones not tried yet, best first.
+static int remaining_moves(movePicker* mp, searchNode* node) {
+  if (mp->stage != PICK_REST) {
+    mp->stage = PICK_REST;
+    generate_remaining(mp, node);
+  }
+  sort_insertion(mp->moves + mp->next, mp->num_moves - mp->next, 0);
+  return mp->num_moves;
+}
+
+
+
+// -----------------------------------------------------------------------------
+// Move loop (Young Brothers Wait)
+// -----------------------------------------------------------------------------
+
+// Number of moves of node to search one at a time before the others are
+// searched in parallel.  Nodes shallower than SPLIT_DEPTH are not worth the
+// spawn overhead and stay serial throughout.  In SMP_LAZY mode the parallelism
+// comes from the helper threads instead, and every node is serial.
+//
+// https://www.chessprogramming.org/Young_Brothers_Wait_Concept
+static int serial_prefix(searchNode* node) {
+  if (SMP_MODE == SMP_LAZY || node->depth < SPLIT_DEPTH) {
+    return MAX_NUM_MOVES;
+  }
+  return node->type == SEARCH_SCOUT ? YBWC_SCOUT : YBWC_PV;
+}
+
+// Searches mv, the mv_index-th move tried at node, and folds its score into
+// node.  mutex is held while doing so if it is not NULL, that is, while the
+// moves of node are being searched in parallel.  Returns true when node needs
+// no more moves searched: on a cutoff, or when the search is being aborted.
+static bool search_move(searchNode* node, movePicker* picker, move_t mv,
+                        int mv_index, searchType_t type,
+                        simple_mutex_t* mutex, uint64_t* node_count_serial) {
+  if (TRACE_MOVES) {
+    print_move_info(mv, node->ply);
+  }
+
+  // increase node count
+  __sync_fetch_and_add(node_count_serial, 1);
+  STATS_ADD(nodes, 1);
+  if (node->quiescence) {
+    STATS_ADD(qnodes, 1);
+  }
+  // Searched one at a time, the move is done on node's position and taken
+  // back.  Brothers searched in parallel need positions of their own.
+  searchNode next_node;
+  position_t position;
+  undo_t undo;
+  if (mutex == NULL) {
+    next_node.position = node->position;
+  } else {
+    position = *node->position;
+    next_node.position = &position;
+  }
+  moveEvaluationResult result = evaluateMove(node, &next_node, mv, &undo,
+                                             picker->killer_a,
+                                             picker->killer_b, type,
+                                             node_count_serial);
+  if (mutex == NULL) {
+    undo_move(node->position, mv, &undo);
+  }
+  if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE) {
+    return false;
+  }
+  if (abortf || parallel_node_aborted(node) || parallel_parent_aborted(node)) {
+    return true;
+  }
+
+  // A legal move is a move that's not KO, but when we are in quiescence
+  // we only want to count moves that has a capture.
+  if (result.type == MOVE_EVALUATED) {
+    __sync_fetch_and_add(&(node->legal_move_count), 1);
+  }
+
+  if (mutex != NULL) {
+    simple_acquire(mutex);
+    if (parallel_node_aborted(node)) {
+      simple_release(mutex);
+      return true;
+    }
+  }
+
+  // process the score. Note that this mutates fields in node.
+  bool cutoff = search_process_score(node, &next_node, mv, mv_index, &result,
+                                     type);
+  if (cutoff) {
+    STATS_ADD(cutoffs, 1);
+    STATS_ADD(first_cutoffs, mv_index == 0);
+    STATS_ADD(cutoff_moves, mv_index + 1);
+    if (mutex != NULL) {
+      abort_node(node);  // stop the brothers still being searched
     } else {
-      ptype_t  pce = ptype_mv_of(mv);
-      rot_t    ro  = rot_of(mv);   // rotation
-      square_t fs  = from_square(mv);
-      int      ot  = ORI_MASK & (ori_of(node->position.board[fs]) + ro);
-      square_t ts  = to_square(mv);
-      set_sort_key(&move_list[mv_index],
-                   best_move_history[BMH(fake_color_to_move, pce, ts, ot)]);
+      node->abort = true;
     }
   }
-  return num_of_moves;
+
+  if (mutex != NULL) {
+    simple_release(mutex);
+  }
+  return cutoff;
 }
 
+// Searches the moves of node as handed out by picker: the first
+// serial_prefix(node) of them one at a time, so that a cutoff among them
+// (the common case at cut nodes) spawns nothing, and then the rest in
+// parallel.  Returns the number of moves tried, which are the first ones in
+// picker->moves.
+static int search_moves(searchNode* node, movePicker* picker,
+                        searchType_t type, uint64_t* node_count_serial) {
+  int num_serial = serial_prefix(node);
+  int num_tried = 0;
+
+  while (num_tried < num_serial) {
+    if (should_abort_check() || parallel_parent_aborted(node)) {
+      return num_tried;
+    }
+    move_t mv = next_move(picker, node);
+    if (mv == 0) {
+      return num_tried;
+    }
+    int mv_index = num_tried++;
+    if (search_move(node, picker, mv, mv_index, type, NULL,
+                    node_count_serial)) {
+      return num_tried;
+    }
+  }
+
+  // A simple mutex. See simple_mutex.h for implementation details.
+  simple_mutex_t node_mutex;
+  init_simple_mutex(&node_mutex);
 
+  int num_of_moves = remaining_moves(picker, node);
+  cilk_for (int i = num_tried; i < num_of_moves; i++) {
+    if (parallel_node_aborted(node) || parallel_parent_aborted(node) ||
+        should_abort_check()) {
+      continue;
+    }
+    // Moves are claimed in order, so that moves[0..num_tried) are the ones
+    // actually tried.
+    int mv_index = __sync_fetch_and_add(&num_tried, 1);
+    move_t mv = get_move(picker->moves[mv_index]);
+    search_move(node, picker, mv, mv_index, type, &node_mutex,
+                node_count_serial);
+  }
+  return num_tried;
+}
@@ -8,7 +8,6 @@
 // FORMAT: killer[ply][id]
 #define __KMT_dim__ [MAX_PLY_IN_SEARCH*4]  // NOLINT(whitespace/braces)
 #define KMT(ply, id) (4 * ply + id)
-static move_t killer __KMT_dim__;  // up to 4 killers
 
 // Best move history table and lookup function
 //
@@ -20,16 +19,86 @@ static move_t killer __KMT_dim__;  // up to 4 killers
     (color * 6 * ARR_SIZE * NUM_ORI + piece * ARR_SIZE * NUM_ORI + \
      square * NUM_ORI + ori)
 
-static int best_move_history __BMH_dim__;
+// Each worker orders moves with tables of its own, so that updating them does
+// not bounce cache lines between cores.  merge_move_ordering() averages the
+// history tables of the workers that searched into a shared base at the end of
+// every iteration, or at the end of the search when Lazy SMP helpers run
+// through the iterations on their own.  A worker copies the base into its own
+// table the first time it orders moves after a merge.  Killers stay with the
+// worker that found them: they are about the positions at a ply of its own
+// part of the tree.
+typedef struct {
+  move_t killer __KMT_dim__;  // up to 4 killers
+  int best_move_history __BMH_dim__;
+  int epoch;  // merge_epoch of the base best_move_history started from
+  bool used;  // updated since the last merge
+} __attribute__((aligned(64))) moveOrderingTables;
+
+static moveOrderingTables move_ordering[MAX_WORKERS];
+static int merged_history __BMH_dim__;  // the base all workers start from
+static int merge_epoch = 0;  // bumped when merged_history changes
+
+static inline moveOrderingTables* worker_move_ordering() {
+  moveOrderingTables* tables = &move_ordering[worker_id()];
+  if (tables->epoch != merge_epoch) {
+    memcpy(tables->best_move_history, merged_history, sizeof(merged_history));
+    tables->epoch = merge_epoch;
+  }
+  return tables;
+}
 
 void init_best_move_history() {
-  memset(best_move_history, 0, sizeof(best_move_history));
+  memset(merged_history, 0, sizeof(merged_history));
+  merge_epoch++;
+  for (int w = 0; w < MAX_WORKERS; w++) {
+    move_ordering[w].used = false;
+  }
+}
+
+// Forgets everything learned about move ordering, killers included, for
+// searches that must not depend on the ones before (bench).
+void clear_move_ordering() {
+  memset(move_ordering, 0, sizeof(move_ordering));
+  memset(merged_history, 0, sizeof(merged_history));
+  merge_epoch = 0;
+}
+
+// Averages the history tables of the workers that searched since the last
+// call into the base every worker picks up next.  Only runs while no worker
+// searches.
+void merge_move_ordering() {
+  if (!MERGE_ORDERING) {
+    return;
+  }
+  moveOrderingTables* used[MAX_WORKERS];
+  int num_used = 0;
+  for (int w = 0; w < MAX_WORKERS; w++) {
+    if (move_ordering[w].used) {
+      used[num_used++] = &move_ordering[w];
+      move_ordering[w].used = false;
+    }
+  }
+  if (num_used == 0) {
+    return;
+  }
+
+  for (int i = 0; i < sizeof(merged_history) / sizeof(merged_history[0]);
+       i++) {
+    int sum = 0;
+    for (int u = 0; u < num_used; u++) {
+      sum += used[u]->best_move_history[i];
+    }
+    merged_history[i] = sum / num_used;
+  }
+  merge_epoch++;
 }
 
 static void update_best_move_history(position_t* p, int index_of_best,
                                      sortable_move_t* lst, int count) {
   tbassert(ENABLE_TABLES, "Tables weren't enabled.\n");
 
+  moveOrderingTables* tables = worker_move_ordering();
+  int* best_move_history = tables->best_move_history;
   int color_to_move = color_to_move_of(p);
 
   for (int i = 0; i < count; i++) {
@@ -51,28 +120,29 @@ static void update_best_move_history(position_t* p, int index_of_best,
 
     best_move_history[BMH(color_to_move, pce, ts, ot)] = s;
   }
+  tables->used = true;
 }
 
 static void update_transposition_table(searchNode* node) {
   if (node->type == SEARCH_SCOUT) {
     if (node->best_score < node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
                        UPPER, 0);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
                        LOWER, node->subpv[0]);
     }
   } else if (node->type == SEARCH_PV) {
     if (node->best_score <= node->orig_alpha) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply), UPPER, 0);
     } else if (node->best_score >= node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply), LOWER, node->subpv[0]);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply), EXACT, node->subpv[0]);
     }
   }
@@ -0,0 +1,131 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Search statistics
+//
+// With the search_stats option set, every worker counts what happens at the
+// nodes it searches: how often the transposition table helps, how soon nodes
+// cut off, and how much the forward pruning and reductions fire.  The counts
+// are totalled at the end of every iteration, reported as an "info string
+// stats" line, and kept per depth until the next search so that the stats
+// command can write them out as CSV.
+//
+// Building with ENABLE_STATS false compiles the counting out altogether.
+
+#ifndef ENABLE_STATS
+#define ENABLE_STATS true
+#endif
+
+// The counters, listed once for the struct and for totalling them
+#define SEARCH_STATS_FIELDS(X)                                              \
+  X(nodes)           /* moves searched below the root */                    \
+  X(qnodes)          /* ... at quiescence nodes */                          \
+  X(tt_probes)                                                              \
+  X(tt_hits)         /* a record was found */                               \
+  X(tt_usable)       /* ... and its score settled the node */               \
+  X(cutoffs)         /* nodes that failed high on a move */                 \
+  X(first_cutoffs)   /* ... on the first move tried */                      \
+  X(cutoff_moves)    /* moves tried at those nodes, summed */               \
+  X(nmm_prunes)      /* nodes cut by the null move margin */                \
+  X(fut_prunes)      /* nodes turned into quiescence by futility */         \
+  X(lmr_reductions)  /* moves searched reduced */                           \
+  X(lmr_researches)  /* ... and searched again at full depth */
+
+typedef struct searchStats {
+#define STATS_FIELD(field) uint64_t field;
+  SEARCH_STATS_FIELDS(STATS_FIELD)
+#undef STATS_FIELD
+} __attribute__((aligned(64))) searchStats_t;
+
+static searchStats_t search_stats[MAX_WORKERS];
+
+// Counts are added atomically: a slot is only written by its own worker, but
+// Lazy SMP helpers keep counting while an iteration's totals are taken.
+#define STATS_ADD(field, n)                                        \
+  do {                                                             \
+    if (ENABLE_STATS && SEARCH_STATS) {                            \
+      __sync_fetch_and_add(&search_stats[worker_id()].field, (n)); \
+    }                                                              \
+  } while (0)
+
+// Totals of one iteration
+typedef struct searchStatsRow {
+  int depth;
+  double time;           // milliseconds since the search started
+  double abort_latency;  // milliseconds from abort request to the iteration
+                         //   returning, or -1 if it was not aborted
+  searchStats_t totals;
+} searchStatsRow_t;
+
+#define MAX_STATS_ROWS 128
+
+static searchStatsRow_t stats_rows[MAX_STATS_ROWS];
+static int num_stats_rows = 0;
+
+// When the pending abort was asked for: the deadline for a timeout, or the
+// time stop came in.
+static double abort_requested;
+
+void search_stats_reset() {
+  memset(search_stats, 0, sizeof(search_stats));
+  num_stats_rows = 0;
+}
+
+static double percent(uint64_t part, uint64_t whole) {
+  return whole == 0 ? 0.0 : 100.0 * part / whole;
+}
+
+void search_stats_iteration(int depth, double et, bool aborted, FILE* out) {
+  if (!ENABLE_STATS || !SEARCH_STATS || num_stats_rows == MAX_STATS_ROWS) {
+    return;
+  }
+  searchStatsRow_t* row = &stats_rows[num_stats_rows++];
+  row->depth = depth;
+  row->time = et;
+  row->abort_latency = aborted ? milliseconds() - abort_requested : -1;
+
+  // Each count is taken out of the workers' slots atomically, as helpers may
+  // still be counting.
+  searchStats_t* t = &row->totals;
+  memset(t, 0, sizeof(*t));
+  for (int i = 0; i < MAX_WORKERS; i++) {
+    searchStats_t* s = &search_stats[i];
+#define STATS_TAKE(field) t->field += __sync_fetch_and_and(&s->field, 0);
+    SEARCH_STATS_FIELDS(STATS_TAKE)
+#undef STATS_TAKE
+  }
+
+  if (out != NULL) {
+    fprintf(out, "info string stats depth %d nodes %" PRIu64 " qnodes %.1f%% "
+            "tt hits %.1f%% usable %.1f%% cutoffs %" PRIu64 " first %.1f%% "
+            "moves %.2f nmm %" PRIu64 " fut %" PRIu64 " lmr %" PRIu64
+            " research %.1f%%",
+            depth, t->nodes, percent(t->qnodes, t->nodes),
+            percent(t->tt_hits, t->tt_probes),
+            percent(t->tt_usable, t->tt_probes), t->cutoffs,
+            percent(t->first_cutoffs, t->cutoffs),
+            t->cutoffs == 0 ? 0.0 : (double) t->cutoff_moves / t->cutoffs,
+            t->nmm_prunes, t->fut_prunes, t->lmr_reductions,
+            percent(t->lmr_researches, t->lmr_reductions));
+    if (aborted) {
+      fprintf(out, " abort latency %.1f", row->abort_latency);
+    }
+    fprintf(out, "\n");
+  }
+}
+
+void search_stats_dump(FILE* out) {
+  fprintf(out, "depth,time,nodes,qnodes,tt_probes,tt_hits,tt_usable,cutoffs,"
+          "first_cutoffs,cutoff_moves,nmm_prunes,fut_prunes,lmr_reductions,"
+          "lmr_researches,abort_latency\n");
+  for (int i = 0; i < num_stats_rows; i++) {
+    searchStatsRow_t* row = &stats_rows[i];
+    searchStats_t* t = &row->totals;
+    fprintf(out, "%d,%.1f,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%"
+            PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+            ",%" PRIu64 ",%" PRIu64 ",%.1f\n",
+            row->depth, row->time, t->nodes, t->qnodes, t->tt_probes,
+            t->tt_hits, t->tt_usable, t->cutoffs, t->first_cutoffs,
+            t->cutoff_moves, t->nmm_prunes, t->fut_prunes, t->lmr_reductions,
+            t->lmr_researches, row->abort_latency);
+  }
+}
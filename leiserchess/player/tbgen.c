@@ -0,0 +1,240 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Endgame tablebase generator
+//
+// Usage: tbgen <file> [pawns]
+//
+// Solves every position with both kings and at most pawns pawns (0 or 1, in
+// any color, on any square, in any orientation) and writes the distances to
+// win in the format end_game.c maps (see end_game.h).
+//
+// The table is solved by retrograde analysis, one distance at a time: pass d
+// finds the positions whose game ends in exactly d plies, from the ones found
+// by the passes before.  A position is won in d if some move leads to a
+// position lost in d - 1 (or zaps the opposing king, for d = 1), and lost in
+// d if every move leads to a position won in at most d - 1 (or zaps its own
+// king), the longest of them taking d - 1.  Positions still unresolved when a
+// pass finds nothing are draws.  Children are found by making the moves
+// rather than by generating unmoves, which keeps the laser out of it; as
+// children of a pass only count if resolved by earlier passes, the positions
+// of a pass are solved in parallel without any ordering between them.
+//
+// The Ko rule and draws by repetition are ignored, so a distance is that of
+// the game without them.
+//
+// https://www.chessprogramming.org/Retrograde_Analysis
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+
+#include <cilk/cilk.h>
+
+#include "./end_game.h"
+#include "./move_gen.h"
+#include "./util.h"
+
+// defined in move_gen.c
+extern int USE_KO;
+
+// Positions solved by one strand of a pass
+#define TB_CHUNK 4096
+
+static int8_t* table;
+static uint64_t num_entries;
+static int pawns;
+
+// Places a king or pawn of color c, with orientation and pieceLocations index
+// taken from slot, on p.
+static void place(position_t* p, ptype_t typ, color_t c, int slot, int ind) {
+  square_t sq = square_of_bb_index[slot / NUM_ORI];
+  piece_t x = 0;
+  set_ptype(&x, typ);
+  set_color(&x, c);
+  set_ori(&x, slot % NUM_ORI);
+  set_piece_index(&x, ind);
+  p->board[sq] = x;
+  p->pieceLocations[c][ind] = sq;
+  if (typ == KING) {
+    p->kloc[c] = sq;
+  }
+}
+
+// Sets p to the position at index, the inverse of tb_index().  Returns false
+// if index is not a position.
+static bool position_of(uint64_t index, position_t* p) {
+  int pawn_slot = 0;
+  if (pawns > 0) {
+    pawn_slot = index % TB_PAWN_SLOTS;
+    index /= TB_PAWN_SLOTS;
+  }
+  int bk = index % TB_KING_SLOTS;
+  index /= TB_KING_SLOTS;
+  int wk = index % TB_KING_SLOTS;
+  int stm = index / TB_KING_SLOTS;
+
+  int pawn_sq = pawn_slot == 0 ? -1 : ((pawn_slot - 1) % TB_KING_SLOTS) / NUM_ORI;
+  if (wk / NUM_ORI == bk / NUM_ORI || wk / NUM_ORI == pawn_sq ||
+      bk / NUM_ORI == pawn_sq) {
+    return false;
+  }
+
+  for (int i = 0; i < ARR_SIZE; i++) {
+    p->board[i] = 0;
+    set_ptype(&p->board[i], INVALID);
+  }
+  for (int i = 0; i < NUM_BB_SQUARES; i++) {
+    p->board[square_of_bb_index[i]] = 0;
+  }
+  for (int c = 0; c < 2; c++) {
+    for (int i = 0; i < NUM_PIECES_SIDE; i++) {
+      p->pieceLocations[c][i] = -1;
+    }
+  }
+  place(p, KING, WHITE, wk, 0);
+  place(p, KING, BLACK, bk, 0);
+  if (pawn_slot > 0) {
+    place(p, PAWN, (pawn_slot - 1) / TB_KING_SLOTS,
+          (pawn_slot - 1) % TB_KING_SLOTS, 1);
+  }
+
+  p->history = NULL;
+  p->ply = stm;
+  p->last_move = 0;
+  p->victims.zapped_count = 0;
+  p->victims.zapped = 0;
+  compute_bitboards(p);
+  p->key = compute_zob_key(p);
+  return true;
+}
+
+// Value of p if its game ends in exactly d plies (see end_game.h), otherwise
+// TB_UNKNOWN.
+static int8_t solve(position_t* p, int d) {
+  sortable_move_t moves[MAX_NUM_MOVES];
+  int num_moves = generate_all(p, moves, true);
+  color_t stm = color_to_move_of(p);
+  bool all_lose = true;
+  int longest = 0;  // longest loss
+
+  for (int i = 0; i < num_moves; i++) {
+    position_t child;
+    victims_t victims = make_move(p, &child, get_move(moves[i]));
+    if (victims.zapped_count > 0 && ptype_of(victims.zapped) == KING) {
+      if (color_of(victims.zapped) != stm) {
+        return 1;
+      }
+      longest = longest > 1 ? longest : 1;  // zapped our own king
+      continue;
+    }
+    int value = table[tb_index(&child, pawns)];
+    if (value == 0 || value == TB_UNKNOWN || abs(value) >= d) {
+      all_lose = false;  // unresolved as yet, or only in this pass
+      continue;
+    }
+    if (value < 0) {
+      return -value + 1;
+    }
+    longest = longest > value + 1 ? longest : value + 1;
+  }
+  if (all_lose && longest == d) {
+    return -d;
+  }
+  return TB_UNKNOWN;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <file> [pawns]\n", argv[0]);
+    return 1;
+  }
+  pawns = argc > 2 ? atoi(argv[2]) : TB_MAX_PAWNS;
+  if (pawns < 0 || pawns > TB_MAX_PAWNS) {
+    fprintf(stderr, "pawns must be between 0 and %d\n", TB_MAX_PAWNS);
+    return 1;
+  }
+
+  setbuf(stdout, NULL);  // progress as it comes
+  init_zob();
+  init_bitboards();
+  USE_KO = 0;  // positions have no history
+
+  num_entries = tb_num_entries(pawns);
+  table = malloc(num_entries);
+  if (table == NULL) {
+    fprintf(stderr, "Could not allocate %" PRIu64 " entries\n", num_entries);
+    return 1;
+  }
+  memset(table, TB_UNKNOWN, num_entries);
+
+  double start = milliseconds();
+  int d;
+  for (d = 1; d <= INT8_MAX; d++) {
+    uint64_t wins = 0;
+    uint64_t losses = 0;
+    cilk_for (uint64_t chunk = 0; chunk < num_entries; chunk += TB_CHUNK) {
+      uint64_t end = chunk + TB_CHUNK < num_entries ? chunk + TB_CHUNK
+                                                    : num_entries;
+      uint64_t chunk_wins = 0;
+      uint64_t chunk_losses = 0;
+      for (uint64_t i = chunk; i < end; i++) {
+        position_t p;
+        if (table[i] != TB_UNKNOWN || !position_of(i, &p)) {
+          continue;
+        }
+        int8_t value = solve(&p, d);
+        if (value != TB_UNKNOWN) {
+          table[i] = value;
+          if (value > 0) {
+            chunk_wins++;
+          } else {
+            chunk_losses++;
+          }
+        }
+      }
+      __sync_fetch_and_add(&wins, chunk_wins);
+      __sync_fetch_and_add(&losses, chunk_losses);
+    }
+    printf("ply %3d: %" PRIu64 " won, %" PRIu64 " lost (%.0f s)\n", d, wins,
+           losses, (milliseconds() - start) / 1000);
+    if (wins + losses == 0) {
+      break;
+    }
+  }
+
+  // Whatever is left can be held by both sides, unless we ran out of
+  // distances to store.
+  uint64_t draws = 0;
+  if (d <= INT8_MAX) {
+    for (uint64_t i = 0; i < num_entries; i++) {
+      position_t p;
+      if (table[i] == TB_UNKNOWN && position_of(i, &p)) {
+        table[i] = 0;
+        draws++;
+      }
+    }
+  }
+  printf("%" PRIu64 " drawn\n", draws);
+
+  FILE* f = fopen(argv[1], "wb");
+  if (f == NULL) {
+    fprintf(stderr, "Could not write %s\n", argv[1]);
+    return 1;
+  }
+  tbHeader_t header;
+  memcpy(header.magic, TB_MAGIC, sizeof(header.magic));
+  header.pawns = pawns;
+  header.entries = num_entries;
+  if (fwrite(&header, sizeof(header), 1, f) != 1 ||
+      fwrite(table, 1, num_entries, f) != num_entries) {
+    fprintf(stderr, "Could not write %s\n", argv[1]);
+    fclose(f);
+    return 1;
+  }
+  fclose(f);
+  printf("wrote %" PRIu64 " entries to %s\n", num_entries, argv[1]);
+  return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Time management
+//
+// A timed search aims at an optimum time per move, derived from the clock,
+// and may never run past a hard maximum.  Between iterations tm_continue()
+// scales the optimum by how settled the search looks (a best move that keeps
+// changing, or a root fail-low, buys time; a best move that has not changed in
+// a while gives some back), and starts the next iteration only if it is
+// predicted to end in time.  Every decision is reported as an "info string tm"
+// line.
+//
+// https://www.chessprogramming.org/Time_Management
+
+#include "./timeman.h"
+
+#include <float.h>
+
+int TM_MAX_RATIO;  // hard limit, as a multiple of the optimum time
+int TM_STABLE;     // iterations without a new best move for it to dominate
+
+// Scaling of the optimum time
+#define TM_UNSTABLE_SCALE 1.4  // the best move changed in the last iteration
+#define TM_FAIL_LOW_SCALE 1.5  // the root failed low in the last iteration
+#define TM_STABLE_SCALE   0.5  // the best move has dominated for TM_STABLE
+
+// Bounds on the effective branching factor used for predictions
+#define TM_MIN_EBF 1.5
+#define TM_MAX_EBF 10.0
+
+static FILE*  tm_out = NULL;  // NULL when there is no clock to report on
+static double tm_optimum;     // milliseconds we aim to spend on the move
+static double tm_max;         // milliseconds we may never exceed
+
+static move_t tm_best;        // best move of the last iteration
+static int    tm_stable;      // iterations tm_best has been the best move
+static bool   tm_failed_low;  // the root failed low during this iteration
+static double tm_last_et;     // time the last iteration ended at
+static double tm_last_time;   // time the last iteration took
+static double tm_ebf;         // effective branching factor, in time
+
+static void tm_reset() {
+  tm_best = 0;
+  tm_stable = 0;
+  tm_failed_low = false;
+  tm_last_et = 0.0;
+  tm_last_time = 0.0;
+  tm_ebf = TM_MIN_EBF;
+}
+
+void tm_start(FILE* out, double time_left, double inc) {
+  tm_reset();
+  tm_out = out;
+
+  tm_optimum = time_left * 0.02;  // use about 1/50 of main time
+  tm_optimum += inc * 0.80;       // use most of increment
+  // sanity check,  make sure that we don't run ourselves too low
+  if (tm_optimum * 10 > time_left) {
+    tm_optimum = time_left / 10.0;
+  }
+  tm_max = tm_optimum * TM_MAX_RATIO;
+  if (tm_max > time_left / 2) {
+    tm_max = time_left / 2;
+  }
+
+  if (tm_out != NULL) {
+    fprintf(tm_out, "info string tm start optimum %.0f maximum %.0f\n",
+            tm_optimum, tm_max);
+  }
+}
+
+void tm_start_unlimited() {
+  tm_reset();
+  tm_out = NULL;
+  tm_optimum = DBL_MAX;
+  tm_max = DBL_MAX;
+}
+
+double tm_maximum() {
+  return tm_max;
+}
+
+void tm_fail_low(int depth) {
+  if (!tm_failed_low && tm_out != NULL) {
+    fprintf(tm_out, "info string tm depth %d fail-low extends\n", depth);
+  }
+  tm_failed_low = true;
+}
+
+bool tm_continue(int depth, move_t best, score_t score, double et) {
+  if (best == tm_best) {
+    tm_stable++;
+  } else {
+    tm_best = best;
+    tm_stable = 0;
+  }
+
+  // Each iteration takes about tm_ebf times as long as the one before.
+  double time = et - tm_last_et;
+  if (tm_last_time >= 1.0) {
+    double ebf = time / tm_last_time;
+    ebf = (tm_ebf + ebf) / 2;
+    tm_ebf = ebf < TM_MIN_EBF ? TM_MIN_EBF :
+             ebf > TM_MAX_EBF ? TM_MAX_EBF : ebf;
+  }
+  tm_last_et = et;
+  tm_last_time = time;
+  double predicted = time * tm_ebf;
+
+  double scale = 1.0;
+  if (tm_stable == 0 && depth > 1) {
+    scale *= TM_UNSTABLE_SCALE;
+  } else if (tm_stable >= TM_STABLE) {
+    scale *= TM_STABLE_SCALE;
+  }
+  if (tm_failed_low) {
+    scale *= TM_FAIL_LOW_SCALE;
+  }
+  tm_failed_low = false;
+  double optimum = tm_optimum * scale;
+
+  const char* verdict = "continue";
+  bool go_on = true;
+  if (et >= optimum) {
+    verdict = "stop (optimum reached)";
+    go_on = false;
+  } else if (et + predicted > tm_max) {
+    verdict = "stop (next iteration would not finish)";
+    go_on = false;
+  } else if (et + predicted > 2 * optimum) {
+    verdict = "stop (next iteration too long)";
+    go_on = false;
+  }
+
+  if (tm_out != NULL) {
+    fprintf(tm_out, "info string tm depth %d score %d time %.0f stable %d "
+            "scale %.2f optimum %.0f ebf %.2f predicted %.0f %s\n",
+            depth, score, et, tm_stable, scale, optimum, tm_ebf, predicted,
+            verdict);
+  }
+  return go_on;
+}
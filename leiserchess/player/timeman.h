@@ -0,0 +1,32 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Time management: how long to think on a move, and when to stop iterating
+
+#ifndef TIMEMAN_H
+#define TIMEMAN_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "./move_gen.h"
+#include "./search.h"
+
+// Starts timing a search with time_left milliseconds on the clock and inc
+// milliseconds added per move.  Decisions are reported on out.
+void tm_start(FILE* out, double time_left, double inc);
+
+// Starts timing a search that only stops on depth or stop (go depth, go
+// infinite, pondering).
+void tm_start_unlimited();
+
+// Milliseconds after which the search must be aborted, wherever it is.
+double tm_maximum();
+
+// The root failed low at depth: the previous best move is in trouble.
+void tm_fail_low(int depth);
+
+// Iteration depth is over, after et milliseconds since the search started,
+// with best move best scoring score.  Returns whether to start the next one.
+bool tm_continue(int depth, move_t best, score_t score, double et);
+
+#endif  // TIMEMAN_H
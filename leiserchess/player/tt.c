@@ -9,29 +9,96 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <cilk/cilk.h>
 #include "./tbassert.h"
 
+#ifndef MAP_ANONYMOUS
+  #define MAP_ANONYMOUS MAP_ANON
+#endif
+
 int HASH;     // hash table size in MBytes
 int USE_TT;   // Use the transposition table.
 // Turn off for deterministic behavior of the search.
+int TT_HUGEPAGES;  // Back the table with (transparent) huge pages.
+int TT_PREFAULT;   // Touch every page of the table when it is allocated.
 
 // the actual record that holds the data for the transposition
 // typedef to be ttRec_t in tt.h
+//
+// The table is lockless: the move, score, quality, bound and age are packed
+// into a single 64-bit data word, and the key is stored XORed with that word.
+// A reader that sees a half-written record (key from one writer, data from
+// another) recomputes a key that does not match and treats it as a miss.
+//
+// https://www.chessprogramming.org/Shared_Hash_Table#Lockless
 struct ttRec {
-  uint64_t  key;
-  move_t    move;
-  score_t   score;
-  int       quality;
-  ttBound_t bound;
-  int       age;
+  uint64_t  key;    // hash key ^ data
+  uint64_t  data;   // packed record, see the TT_*_SHIFT fields below
 };
 
+// Layout of the data word (low to high bits):
+//   move (28) | score (16) | quality (8) | bound (2) | age (6) | unused (4)
+//
+// Together with the key word a record is 16 bytes, so a 4-way set fills
+// exactly one 64-byte cache line and a probe touches a single line.
+#define TT_MOVE_SHIFT     0
+#define TT_MOVE_MASK      MOVE_MASK
+#define TT_SCORE_SHIFT    28
+#define TT_SCORE_MASK     0xffffULL
+#define TT_QUALITY_SHIFT  44
+#define TT_QUALITY_MASK   0xffULL
+#define TT_BOUND_SHIFT    52
+#define TT_BOUND_MASK     0x3ULL
+#define TT_AGE_SHIFT      54
+#define TT_AGE_MASK       0x3fULL    // age wraps every 64 searches
+
+static inline uint64_t tt_pack(move_t move, score_t score, int quality,
+                               ttBound_t bound, unsigned age) {
+  // quality is the search depth; clamp it into a signed byte
+  if (quality > INT8_MAX) {
+    quality = INT8_MAX;
+  }
+  if (quality < INT8_MIN) {
+    quality = INT8_MIN;
+  }
+  return (((uint64_t) move & TT_MOVE_MASK) << TT_MOVE_SHIFT) |
+         (((uint64_t)(uint16_t) score & TT_SCORE_MASK) << TT_SCORE_SHIFT) |
+         (((uint64_t)(uint8_t) quality & TT_QUALITY_MASK) << TT_QUALITY_SHIFT) |
+         (((uint64_t) bound & TT_BOUND_MASK) << TT_BOUND_SHIFT) |
+         (((uint64_t) age & TT_AGE_MASK) << TT_AGE_SHIFT);
+}
+
+static inline move_t tt_data_move(uint64_t data) {
+  return (move_t)((data >> TT_MOVE_SHIFT) & TT_MOVE_MASK);
+}
+
+static inline score_t tt_data_score(uint64_t data) {
+  return (score_t)(int16_t)((data >> TT_SCORE_SHIFT) & TT_SCORE_MASK);
+}
+
+static inline int tt_data_quality(uint64_t data) {
+  return (int8_t)((data >> TT_QUALITY_SHIFT) & TT_QUALITY_MASK);
+}
+
+static inline ttBound_t tt_data_bound(uint64_t data) {
+  return (ttBound_t)((data >> TT_BOUND_SHIFT) & TT_BOUND_MASK);
+}
+
+static inline unsigned tt_data_age(uint64_t data) {
+  return (unsigned)((data >> TT_AGE_SHIFT) & TT_AGE_MASK);
+}
+
 
 // each set is a 4-way set-associative cache and contains 4 records
 #define RECORDS_PER_SET 4
+#define TT_SET_ALIGN 64  // cache line size
 typedef struct {
   ttRec_t records[RECORDS_PER_SET];
-} ttSet_t;
+} __attribute__((aligned(TT_SET_ALIGN))) ttSet_t;
+
+_Static_assert(sizeof(ttSet_t) == TT_SET_ALIGN,
+               "a transposition table set must fill exactly one cache line");
 
 
 // struct def for the global transposition table
@@ -40,18 +107,24 @@ struct ttHashtable {
   uint64_t mask;           // a mask to map from key to set index
   unsigned age;
   ttSet_t* tt_set;         // array of sets that contains the transposition
-  pthread_mutex_t* locks;
+  void*    mapping;        // start of the mmap'ed region, NULL if malloc'ed
+  size_t   mapping_size;   // size of the mmap'ed region in bytes
 } hashtable;  // name of the global transposition table
 
+// tt_hashtable_get hands out a pointer to a private copy of the record, so
+// that a concurrent tt_hashtable_put cannot change it under the caller.  The
+// copy is only valid until the next tt_hashtable_get on the same worker.
+static __thread ttRec_t probe_rec;
+
 
 // getting the move out of the record
 move_t tt_move_of(ttRec_t* rec) {
-  return rec->move;
+  return tt_data_move(rec->data);
 }
 
 // getting the score out of the record
 score_t tt_score_of(ttRec_t* rec) {
-  return rec->score;
+  return tt_data_score(rec->data);
 }
 
 size_t tt_get_bytes_per_record() {
@@ -62,6 +135,69 @@ uint32_t tt_get_num_of_records() {
   return hashtable.num_of_sets * RECORDS_PER_SET;
 }
 
+// -----------------------------------------------------------------------------
+// Table memory
+// -----------------------------------------------------------------------------
+
+// Huge pages cut the dTLB misses of random-access probes into a large table.
+//
+// https://www.kernel.org/doc/html/latest/admin-guide/mm/transhuge.html
+#define HUGE_PAGE_SIZE (2ULL << 20)
+
+// Clearing is done in chunks of this size spread over the cilk workers, so
+// that the first touch of a multi-GB table is not serialized on one core.
+#define TT_CLEAR_CHUNK HUGE_PAGE_SIZE
+
+static void tt_clear_memory(void* mem, size_t size) {
+  char* base = (char*) mem;
+  size_t num_of_chunks = (size + TT_CLEAR_CHUNK - 1) / TT_CLEAR_CHUNK;
+  cilk_for (size_t i = 0; i < num_of_chunks; i++) {
+    size_t offset = i * TT_CLEAR_CHUNK;
+    size_t len = (size - offset < TT_CLEAR_CHUNK) ? size - offset : TT_CLEAR_CHUNK;
+    memset(base + offset, 0, len);
+  }
+}
+
+// Maps size bytes aligned to a huge page and asks the kernel to back them
+// with huge pages.  Returns NULL if the mapping could not be made.
+static void* tt_map_hugepages(size_t size) {
+  // over-allocate so that the start can be moved up to a huge page boundary
+  size_t map_size = size + HUGE_PAGE_SIZE;
+  char* map = (char*) mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map == MAP_FAILED) {
+    return NULL;
+  }
+
+  char* start = (char*)(((uintptr_t) map + HUGE_PAGE_SIZE - 1) &
+                        ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+  // give back the unaligned head and the unused tail
+  if (start > map) {
+    munmap(map, start - map);
+  }
+  size_t tail = (map + map_size) - (start + size);
+  if (tail > 0) {
+    munmap(start + size, tail);
+  }
+
+#ifdef MADV_HUGEPAGE
+  // Not fatal if it fails: we just get regular pages.
+  madvise(start, size, MADV_HUGEPAGE);
+#endif
+  return start;
+}
+
+static void tt_free_memory() {
+  if (hashtable.mapping != NULL) {
+    munmap(hashtable.mapping, hashtable.mapping_size);
+  } else {
+    free(hashtable.tt_set);
+  }
+  hashtable.tt_set = NULL;
+  hashtable.mapping = NULL;
+  hashtable.mapping_size = 0;
+}
+
 void tt_resize_hashtable(int size_in_meg) {
   uint64_t size_in_bytes = (uint64_t) size_in_meg * (1ULL << 20);
   // total number of sets we could have in the hashtable
@@ -78,11 +214,26 @@ void tt_resize_hashtable(int size_in_meg) {
   hashtable.mask = num_of_sets - 1;
   hashtable.age = 0;
 
-  free(hashtable.tt_set);  // free the old ones
-  hashtable.tt_set = (ttSet_t*) malloc(sizeof(ttSet_t) * num_of_sets);
-
-  free(hashtable.locks);
-  hashtable.locks = (pthread_mutex_t*) malloc(sizeof(pthread_mutex_t) * num_of_sets);
+  tt_free_memory();  // free the old ones
+
+  size_t table_size = sizeof(ttSet_t) * num_of_sets;
+  bool needs_clear = true;
+  if (TT_HUGEPAGES) {
+    hashtable.tt_set = (ttSet_t*) tt_map_hugepages(table_size);
+    if (hashtable.tt_set != NULL) {
+      hashtable.mapping = hashtable.tt_set;
+      hashtable.mapping_size = table_size;
+      // anonymous mappings come zeroed; touching them only prefaults
+      needs_clear = TT_PREFAULT;
+    }
+  }
+  if (hashtable.tt_set == NULL) {
+    // fall back to regular pages, aligned so no set straddles two lines
+    if (posix_memalign((void**) &hashtable.tt_set, TT_SET_ALIGN,
+                       table_size) != 0) {
+      hashtable.tt_set = NULL;
+    }
+  }
 
   if (hashtable.tt_set == NULL) {
     fprintf(stderr,  "Hash table too big\n");
@@ -90,36 +241,24 @@ void tt_resize_hashtable(int size_in_meg) {
   }
 
   // might as well clear the table while we are at it
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
-}
-
-void tt_lock_init() {
-  for (int i = 0; i < hashtable.num_of_sets; i++) {
-    pthread_mutex_init(&hashtable.locks[i], NULL);
+  if (needs_clear) {
+    tt_clear_memory(hashtable.tt_set, table_size);
   }
 }
 
-void tt_lock_lock(uint64_t key) {
-  uint64_t set_index = key & hashtable.mask;
-  pthread_mutex_lock(&hashtable.locks[set_index]);
-}
-
-void tt_lock_unlock(uint64_t key) {
-  uint64_t set_index = key & hashtable.mask;
-  pthread_mutex_unlock(&hashtable.locks[set_index]);
+bool tt_uses_hugepages() {
+  return hashtable.mapping != NULL;
 }
 
 void tt_make_hashtable(int size_in_meg) {
   hashtable.tt_set = NULL;
+  hashtable.mapping = NULL;
+  hashtable.mapping_size = 0;
   tt_resize_hashtable(size_in_meg);
-  tt_lock_init();
 }
 
 void tt_free_hashtable() {
-  free(hashtable.tt_set);
-  free(hashtable.locks);
-  hashtable.tt_set = NULL;
-  hashtable.locks = NULL;
+  tt_free_memory();
 }
 
 // age the hash table by incrementing global age
@@ -128,7 +267,7 @@ void tt_age_hashtable() {
 }
 
 void tt_clear_hashtable() {
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  tt_clear_memory(hashtable.tt_set, sizeof(ttSet_t) * hashtable.num_of_sets);
   hashtable.age = 0;
 }
 
@@ -139,10 +278,12 @@ void tt_hashtable_put(uint64_t key, int depth, score_t score,
   tbassert(abs(score) != INF, "Score was infinite.\n");
 
   uint64_t set_index = key & hashtable.mask;
+  unsigned age = hashtable.age & TT_AGE_MASK;
   // current record that we are looking into
   ttRec_t* curr_rec = hashtable.tt_set[set_index].records;
   // best record to replace that we found so far
   ttRec_t* rec_to_replace = curr_rec;
+  int replace_quality = tt_data_quality(curr_rec->data);
   int replacemt_val = -99;            // value of doing the replacement
 
   move = move & MOVE_MASK;
@@ -150,43 +291,48 @@ void tt_hashtable_put(uint64_t key, int depth, score_t score,
   for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
     int value = 0;  // points for sorting
 
+    // Take a snapshot; another worker may be writing this record right now.
+    uint64_t data = curr_rec->data;
+    uint64_t rec_key = curr_rec->key ^ data;
+
     // always use entry if it's not used or has same key
-    if (!curr_rec->key || key == curr_rec->key) {
-      if (move == 0) {
-        move = curr_rec->move;
+    if (!rec_key || key == rec_key) {
+      if (move == 0 && rec_key) {
+        move = tt_data_move(data);
       }
-      curr_rec->key = key;
-      curr_rec->quality = depth;
-      curr_rec->move = move;
-      curr_rec->age = hashtable.age;
-      curr_rec->score = score;
-      curr_rec->bound = (ttBound_t) bound_type;
-
-      return;
+      rec_to_replace = curr_rec;
+      break;
     }
 
     // otherwise, potential candidate for replacement
-    if (curr_rec->age == hashtable.age) {
+    if (tt_data_age(data) == age) {
       value -= 6;   // prefer not to replace if same age
     }
-    if (curr_rec->quality < rec_to_replace->quality) {
+    if (tt_data_quality(data) < replace_quality) {
       value += 1;   // prefer to replace if worse quality
     }
     if (value > replacemt_val) {
       replacemt_val = value;
       rec_to_replace = curr_rec;
+      replace_quality = tt_data_quality(data);
     }
   }
+
   // update the record that we are replacing with this record
-  rec_to_replace->key = key;
-  rec_to_replace->quality = depth;
-  rec_to_replace->move = move;
-  rec_to_replace->age = hashtable.age;
-  rec_to_replace->score = score;
-  rec_to_replace->bound = (ttBound_t) bound_type;
+  uint64_t data = tt_pack(move, score, depth, (ttBound_t) bound_type, age);
+  rec_to_replace->data = data;
+  rec_to_replace->key = key ^ data;
 }
 
 
+// Start loading the set for key into the cache.  Called as soon as a child's
+// key is known, so that the later tt_hashtable_get does not stall on memory.
+//
+// https://www.chessprogramming.org/Transposition_Table#Prefetch
+void tt_prefetch(uint64_t key) {
+  __builtin_prefetch(&hashtable.tt_set[key & hashtable.mask]);
+}
+
 ttRec_t* tt_hashtable_get(uint64_t key) {
   if (!USE_TT) {
     return NULL;  // done if we are not using the transposition table
@@ -197,8 +343,11 @@ ttRec_t* tt_hashtable_get(uint64_t key) {
 
   ttRec_t* found = NULL;
   for (int i = 0; i < RECORDS_PER_SET; i++, rec++) {
-    if (rec->key == key) {  // found the record that we are looking for
-      found = rec;
+    uint64_t data = rec->data;
+    if ((rec->key ^ data) == key) {  // found the record that we are looking for
+      probe_rec.key = key;
+      probe_rec.data = data;
+      found = &probe_rec;
     }
   }
   return found;
@@ -218,7 +367,7 @@ score_t lose_in(int ply) {
 // when you retrieve the score from the hashtable, however, you want to
 // consider the value of the position based on where you are in the search tree
 score_t tt_adjust_score_from_hashtable(ttRec_t* rec, int ply_in_search) {
-  score_t score = rec->score;
+  score_t score = tt_score_of(rec);
   if (score >= win_in(MAX_PLY_IN_SEARCH)) {
     return score - ply_in_search;
   }
@@ -244,14 +393,16 @@ score_t tt_adjust_score_for_hashtable(score_t score, int ply_in_search) {
 bool tt_is_usable(ttRec_t* tt, int depth, score_t beta) {
   // can't use this record if we are searching at depth higher than the
   // depth of this record.
-  if (tt->quality < depth) {
+  if (tt_data_quality(tt->data) < depth) {
     return false;
   }
   // otherwise check whether the score falls within the bounds
-  if ((tt->bound == LOWER) && tt->score >= beta) {
+  ttBound_t bound = tt_data_bound(tt->data);
+  score_t score = tt_data_score(tt->data);
+  if ((bound == LOWER) && score >= beta) {
     return true;
   }
-  if ((tt->bound == UPPER) && tt->score < beta) {
+  if ((bound == UPPER) && score < beta) {
     return true;
   }
 
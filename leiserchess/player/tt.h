@@ -10,7 +10,6 @@
 #include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
-#include <pthread.h>
 
 #include "./move_gen.h"
 #include "./search.h"
@@ -38,20 +37,17 @@ void tt_make_hashtable(int sizeMeg);
 void tt_resize_hashtable(int sizeInMeg);
 void tt_free_hashtable();
 void tt_age_hashtable();
+void tt_clear_hashtable();
+bool tt_uses_hugepages();
 
 // putting / getting transposition data into / from hashtable
 void tt_hashtable_put(uint64_t key, int depth, score_t score,
                       int type, move_t move);
 ttRec_t* tt_hashtable_get(uint64_t key);
+void tt_prefetch(uint64_t key);
 
 score_t tt_adjust_score_from_hashtable(ttRec_t* rec, int ply);
 score_t tt_adjust_score_for_hashtable(score_t score, int ply);
 bool tt_is_usable(ttRec_t* tt, int depth, score_t beta);
 
-void tt_lock_init();
-
-void tt_lock_lock(uint64_t key);
-
-void tt_lock_unlock(uint64_t key);
-
 #endif  // TT_H
@@ -15,6 +15,36 @@
 
 int RESET_RNG;
 
+__thread int thread_worker_slot = -1;
+int cilk_worker_slots = 0;
+
+// Sizes the cilk workers' share of the worker slots, giving the scheduler
+// fewer workers if they would leave less than half of them to helpers.
+void init_workers() {
+#ifdef __cilk
+  int total = __cilkrts_get_total_workers();
+  for (int n = __cilkrts_get_nworkers(); total > MAX_WORKERS / 2 && n > 1;
+       n /= 2) {
+    char nworkers[16];
+    snprintf(nworkers, sizeof(nworkers), "%d", n / 2);
+    if (__cilkrts_set_param("nworkers", nworkers) != 0) {
+      break;  // the scheduler has started already
+    }
+    total = __cilkrts_get_total_workers();
+  }
+  if (total >= MAX_WORKERS) {
+    too_many_workers(total);
+  }
+  cilk_worker_slots = total;
+#endif
+}
+
+void too_many_workers(int id) {
+  fprintf(stderr, "Worker slot %d is out of range: only %d slots\n", id,
+          MAX_WORKERS);
+  abort();
+}
+
 void debug_log(int log_level, const char* errstr, ...) {
   if (log_level >= DEBUG_LOG_THRESH) {
     va_list arg_list;
@@ -44,17 +74,29 @@ double milliseconds() {
 
 // Public domain code for JLKISS64 RNG - long period KISS RNG producing
 // 64-bit results
+#ifdef DEBUG
+static int first_time = 0;
+#else
+static int first_time = 1;
+#endif
+
+// Seed variables
+static uint64_t x = 123456789123ULL, y = 987654321987ULL;
+static unsigned int z1 = 43219876, c1 = 6543217, z2 = 21987643,
+                    c2 = 1732654;  // Seed variables
+
+// Puts the RNG back to its fixed seed, for deterministic tests.
+void reset_rng() {
+  x = 123456789123ULL;
+  y = 987654321987ULL;
+  z1 = 43219876;
+  c1 = 6543217;
+  z2 = 21987643;
+  c2 = 1732654;
+  first_time = 0;
+}
+
 uint64_t myrand() {
-  #ifdef DEBUG
-  static int first_time = 0;
-  #else
-  static int first_time = 1;
-  #endif
-
-  // Seed variables
-  static uint64_t x = 123456789123ULL, y = 987654321987ULL;
-  static unsigned int z1 = 43219876, c1 = 6543217, z2 = 21987643,
-                      c2 = 1732654;  // Seed variables
   static uint64_t t;
 
   if (first_time) {
@@ -73,12 +115,7 @@ uint64_t myrand() {
   //   useful for running deterministic tests.
   if (RESET_RNG) {
     printf("Resetting RNG due to setoption command.\n");
-    x = 123456789123ULL;
-    y = 987654321987ULL;
-    z1 = 43219876;
-    c1 = 6543217;
-    z2 = 21987643;
-    c2 = 1732654;
+    reset_rng();
     RESET_RNG = 0;
   }
 
@@ -30,7 +30,51 @@
 #if MACPORT
   #include "./fasttime.h"
 #endif
+
+#ifdef __cilk
+  #include <cilk/cilk_api.h>
+#endif
+
+// Number of slots in tables kept per worker (statistics and the like)
+#define MAX_WORKERS 256
+
+// Slots [0, cilk_worker_slots) belong to the cilk workers, user workers
+// included, by worker number.  The next one is for a thread that has not
+// entered cilk code, and threads the scheduler does not know about (Lazy SMP
+// helpers, book generation threads) claim the ones after it: see
+// first_helper_slot().  Set by init_workers().
+extern int cilk_worker_slots;
+
+// Slot claimed by a thread the cilk scheduler does not know about, or -1 on
+// threads that leave it to the scheduler.
+extern __thread int thread_worker_slot;
+
+void init_workers();
+void too_many_workers(int id) __attribute__((noreturn));
+
+static inline int first_helper_slot() {
+  return cilk_worker_slots + 1;
+}
+
+// Slot of the worker running the caller, in [0, MAX_WORKERS).  Each slot is
+// only ever used by one thread at a time.
+static inline int worker_id() {
+  int id = thread_worker_slot;
+#ifdef __cilk
+  if (id < 0) {
+    id = __cilkrts_get_worker_number();
+  }
+#endif
+  if (id < 0) {
+    id = cilk_worker_slots;
+  }
+  if (__builtin_expect(id >= MAX_WORKERS, 0)) {
+    too_many_workers(id);
+  }
+  return id;
+}
 void debug_log(int log_level, const char* str, ...);
 double  milliseconds();
 uint64_t myrand();
+void reset_rng();
 #endif  // UTIL_H